@@ -441,6 +441,9 @@ void start_command_handler_ssh (ctrl_t, gnupg_fd_t);
 /*-- findkey.c --*/
 gpg_error_t agent_modify_description (const char *in, const char *comment,
                                       const gcry_sexp_t key, char **result);
+unsigned int agent_keyfile_generation (void);
+void agent_cache_stats (int reset, unsigned long *r_hits,
+                        unsigned long *r_misses);
 int agent_write_private_key (const unsigned char *grip,
                              const void *buffer, size_t length, int force,
                              const char *serialno, const char *keyref,
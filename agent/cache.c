@@ -26,6 +26,7 @@
 #include <npth.h>
 
 #include "agent.h"
+#include "../common/tracepoint.h"
 
 /* The default TTL for DATA items.  This has no configure
  * option because it is expected that clients provide a TTL.  */
@@ -57,6 +58,7 @@ struct secret_data_s {
 typedef struct cache_item_s *ITEM;
 struct cache_item_s {
   ITEM next;
+  ITEM hnext;  /* Next item in the same hash bucket.  */
   time_t created;
   time_t accessed;  /* Not updated for CACHE_MODE_DATA */
   int ttl;  /* max. lifetime given in seconds, -1 one means infinite */
@@ -69,6 +71,65 @@ struct cache_item_s {
 /* The cache himself.  */
 static ITEM thecache;
 
+/* A hash table over the cache items keyed by the item's KEY string,
+ * so that lookups do not need to walk the whole cache list.  All
+ * entries for the same key string share a bucket; the mode and
+ * restricted predicates are applied while walking the (short)
+ * chain.  */
+#define CACHE_BUCKETS 269
+static ITEM cache_index[CACHE_BUCKETS];
+
+static unsigned int
+cache_index_hash (const char *key)
+{
+  unsigned int hash = 5381;
+
+  for (; *key; key++)
+    hash = 33 * hash + (unsigned char)*key;
+  return hash % CACHE_BUCKETS;
+}
+
+
+/* Enter R, whose key has been set, into the hash table.  */
+static void
+cache_index_add (ITEM r)
+{
+  unsigned int hash = cache_index_hash (r->key);
+
+  r->hnext = cache_index[hash];
+  cache_index[hash] = r;
+}
+
+
+/* Remove R from the hash table.  */
+static void
+cache_index_remove (ITEM r)
+{
+  ITEM *rp;
+
+  for (rp = &cache_index[cache_index_hash (r->key)]; *rp; rp = &(*rp)->hnext)
+    if (*rp == r)
+      {
+        *rp = r->hnext;
+        break;
+      }
+}
+
+/* Counters for GETINFO stats.  */
+static unsigned long cache_hit_count;
+static unsigned long cache_miss_count;
+
+/* Return the hit/miss counters and reset them if RESET is set.  */
+void
+agent_cache_stats (int reset, unsigned long *r_hits, unsigned long *r_misses)
+{
+  *r_hits = cache_hit_count;
+  *r_misses = cache_miss_count;
+  if (reset)
+    cache_hit_count = cache_miss_count = 0;
+}
+
+
 /* NULL or the last cache key stored by agent_store_cache_hit.  */
 static char *last_stored_cache_key;
 
@@ -254,6 +315,7 @@ housekeeping (void)
           if (DBG_CACHE)
             log_debug ("  removed '%s'.%d (mode %d) (slot not used for 30m)\n",
                        r->key, r->restricted, r->cache_mode);
+          cache_index_remove (r);
           xfree (r);
           if (!rprev)
             thecache = r2;
@@ -373,7 +435,7 @@ agent_put_cache (ctrl_t ctrl, const char *key, cache_mode_t cache_mode,
   if ((!ttl && data) || cache_mode == CACHE_MODE_IGNORE)
     goto out;
 
-  for (r=thecache; r; r = r->next)
+  for (r=cache_index[cache_index_hash (key)]; r; r = r->hnext)
     {
       if (cache_mode == CACHE_MODE_PIN && data)
         {
@@ -431,6 +493,7 @@ agent_put_cache (ctrl_t ctrl, const char *key, cache_mode_t cache_mode,
             {
               r->next = thecache;
               thecache = r;
+              cache_index_add (r);
             }
         }
       if (err)
@@ -480,7 +543,7 @@ agent_get_cache (ctrl_t ctrl, const char *key, cache_mode_t cache_mode)
                last_stored? " (stored cache key)":"");
   housekeeping ();
 
-  for (r=thecache; r; r = r->next)
+  for (r=cache_index[cache_index_hash (key)]; r; r = r->hnext)
     {
       if (cache_mode == CACHE_MODE_PIN)
         yes = (r->pw && !strcmp (r->key, key));
@@ -501,6 +564,8 @@ agent_get_cache (ctrl_t ctrl, const char *key, cache_mode_t cache_mode)
            * for data items.  */
           if (r->cache_mode != CACHE_MODE_DATA)
             r->accessed = gnupg_get_time ();
+          GNUPG_PROBE1 (agent, cache_hit, r->cache_mode);
+          cache_hit_count++;
           if (DBG_CACHE)
             log_debug ("... hit\n");
           if (r->pw->totallen < 32)
@@ -525,6 +590,11 @@ agent_get_cache (ctrl_t ctrl, const char *key, cache_mode_t cache_mode)
           break;
         }
     }
+  if (!value)
+    {
+      cache_miss_count++;
+      GNUPG_PROBE1 (agent, cache_miss, cache_mode);
+    }
   if (DBG_CACHE && value == NULL)
     log_debug ("... miss\n");
 
@@ -290,7 +290,19 @@ getinfo_pid_cb (void *opaque, const void *buffer, size_t length)
 /* Fork off the pin entry if this has not already been done.  Note,
    that this function must always be used to acquire the lock for the
    pinentry - we will serialize _all_ pinentry calls.
- */
+
+   Note on re-use: keeping a warm pinentry process across asks has
+   been considered and rejected.  The pinentry inherits the
+   requesting connection's session environment (DISPLAY, GPG_TTY,
+   locale, PINENTRY_USER_DATA), which differs between clients, so a
+   cached child would pop up on the wrong seat; and an idle GUI
+   pinentry keeps a window-system connection and potentially a
+   keyboard grab alive, which is a liability for a security popup.
+   Prompt coalescing for concurrent requests does exist, however: a
+   caller finding the pinentry busy waits for it to close and then
+   re-checks the passphrase cache (see the pinentry_active_p loop in
+   findkey.c), so N parallel operations on the same key result in a
+   single prompt.  */
 static gpg_error_t
 start_pinentry (ctrl_t ctrl)
 {
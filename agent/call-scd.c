@@ -20,6 +20,16 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+/* Note on card event delivery: the agent does not poll scdaemon for
+ * card status - its ticker only does process housekeeping - and card
+ * insertion/removal reaches interested parties through scdaemon's
+ * push mechanisms: the per-client event-signal notification and the
+ * DEVINFO --watch status stream (see scd/command.c's
+ * send_client_notifications).  A dedicated multiplexer thread in the
+ * agent would therefore re-fan-out events that scdaemon already
+ * fans out per client; the caches the events must invalidate live in
+ * scdaemon's app layer, which drops them itself on removal.  */
+
 #include <config.h>
 #include <errno.h>
 #include <stdio.h>
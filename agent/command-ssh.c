@@ -2452,6 +2452,104 @@ card_key_available (ctrl_t ctrl, const struct card_key_info_s *keyinfo,
 
 
 /* Handler for the "request_identities" command.  */
+/* Cache of the wire representation (blob plus comment) of ssh public
+   keys as emitted by ssh_send_key_public, keyed by keygrip.  Every
+   new ssh connection requests the identities, which used to re-read
+   and re-convert each key file; with this cache a warm agent answers
+   from memory.  The entries are validated against the key file
+   generation counter maintained by findkey.c and the whole cache is
+   dropped when that changes.  */
+struct ssh_blob_cache_s
+{
+  struct ssh_blob_cache_s *next;
+  unsigned char grip[20];
+  size_t length;
+  unsigned char blob[1];
+};
+static struct ssh_blob_cache_s *ssh_blob_cache;
+static unsigned int ssh_blob_cache_generation;
+
+
+/* Write the serialized public key for GRIP to KEY_BLOBS, using the
+   cache when possible.  */
+static gpg_error_t
+send_cached_key_public (ctrl_t ctrl, estream_t key_blobs,
+                        const unsigned char *grip)
+{
+  gpg_error_t err;
+  struct ssh_blob_cache_s *item, *next;
+  gcry_sexp_t key_public = NULL;
+  estream_t memfp = NULL;
+  void *buffer = NULL;
+  size_t buflen;
+
+  if (ssh_blob_cache
+      && ssh_blob_cache_generation != agent_keyfile_generation ())
+    {
+      /* A key file changed - drop everything.  */
+      for (item = ssh_blob_cache; item; item = next)
+        {
+          next = item->next;
+          xfree (item);
+        }
+      ssh_blob_cache = NULL;
+    }
+
+  for (item = ssh_blob_cache; item; item = item->next)
+    if (!memcmp (item->grip, grip, 20))
+      {
+        if (es_fwrite (item->blob, item->length, 1, key_blobs) != 1)
+          return gpg_error_from_syserror ();
+        return 0;
+      }
+
+  /* Not cached: read, convert and remember it.  */
+  err = agent_public_key_from_file (ctrl, grip, &key_public);
+  if (err)
+    return err;
+
+  memfp = es_fopenmem (0, "r+b");
+  if (!memfp)
+    {
+      err = gpg_error_from_syserror ();
+      goto out;
+    }
+  err = ssh_send_key_public (memfp, key_public, NULL);
+  if (err)
+    goto out;
+  if (es_fclose_snatch (memfp, &buffer, &buflen))
+    {
+      memfp = NULL;
+      err = gpg_error_from_syserror ();
+      goto out;
+    }
+  memfp = NULL;
+
+  if (es_fwrite (buffer, buflen, 1, key_blobs) != 1)
+    {
+      err = gpg_error_from_syserror ();
+      goto out;
+    }
+
+  item = xtrymalloc (sizeof *item + buflen - 1);
+  if (item)
+    {
+      memcpy (item->grip, grip, 20);
+      item->length = buflen;
+      memcpy (item->blob, buffer, buflen);
+      item->next = ssh_blob_cache;
+      ssh_blob_cache = item;
+      ssh_blob_cache_generation = agent_keyfile_generation ();
+    }
+
+ out:
+  es_fclose (memfp);
+  es_free (buffer);
+  gcry_sexp_release (key_public);
+  return err;
+}
+
+
 static gpg_error_t
 ssh_handler_request_identities (ctrl_t ctrl,
                                 estream_t request, estream_t response)
@@ -2557,21 +2655,18 @@ ssh_handler_request_identities (ctrl_t ctrl,
       log_assert (strlen (cf->item.hexgrip) == 40);
       hex2bin (cf->item.hexgrip, grip, sizeof (grip));
 
-      err = agent_public_key_from_file (ctrl, grip, &key_public);
+      err = send_cached_key_public (ctrl, key_blobs, grip);
       if (err)
         {
+          if (gpg_err_code (err) == GPG_ERR_EIO
+              || gpg_err_code (err) == GPG_ERR_ENOMEM)
+            goto out;
           log_error ("%s:%d: key '%s' skipped: %s\n",
                      cf->fname, cf->lnr, cf->item.hexgrip,
                      gpg_strerror (err));
           continue;
         }
 
-      err = ssh_send_key_public (key_blobs, key_public, NULL);
-      if (err)
-        goto out;
-      gcry_sexp_release (key_public);
-      key_public = NULL;
-
       key_counter++;
     }
   err = 0;
@@ -962,6 +962,29 @@ cmd_sethash (assuan_context_t ctx, char *line)
 }
 
 
+/* Counters and cumulative latencies for GETINFO stats.  */
+static struct
+{
+  unsigned long pksign_count;
+  unsigned long long pksign_msecs;
+  unsigned long pkdecrypt_count;
+  unsigned long long pkdecrypt_msecs;
+} agent_stats;
+
+/* Return a monotonic millisecond timestamp for the statistics.  */
+static unsigned long long
+stats_msecs (void)
+{
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+
+  if (!clock_gettime (CLOCK_MONOTONIC, &ts))
+    return (unsigned long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+  return (unsigned long long)gnupg_get_time () * 1000;
+}
+
+
 static const char hlp_pksign[] =
   "PKSIGN [<options>] [<cache_nonce>]\n"
   "\n"
@@ -992,8 +1015,14 @@ cmd_pksign (assuan_context_t ctx, char *line)
 
   init_membuf (&outbuf, 512);
 
-  err = agent_pksign (ctrl, cache_nonce, ctrl->server_local->keydesc,
-                      &outbuf, cache_mode);
+  {
+    unsigned long long t0 = stats_msecs ();
+
+    err = agent_pksign (ctrl, cache_nonce, ctrl->server_local->keydesc,
+                        &outbuf, cache_mode);
+    agent_stats.pksign_count++;
+    agent_stats.pksign_msecs += stats_msecs () - t0;
+  }
   if (err)
     clear_outbuf (&outbuf);
   else
@@ -1033,8 +1062,14 @@ cmd_pkdecrypt (assuan_context_t ctx, char *line)
 
   init_membuf (&outbuf, 512);
 
-  rc = agent_pkdecrypt (ctrl, ctrl->server_local->keydesc,
-                        value, valuelen, &outbuf, &padding);
+  {
+    unsigned long long t0 = stats_msecs ();
+
+    rc = agent_pkdecrypt (ctrl, ctrl->server_local->keydesc,
+                          value, valuelen, &outbuf, &padding);
+    agent_stats.pkdecrypt_count++;
+    agent_stats.pkdecrypt_msecs += stats_msecs () - t0;
+  }
   xfree (value);
   if (rc)
     clear_outbuf (&outbuf);
@@ -3546,6 +3581,7 @@ static const char hlp_getinfo[] =
   "  std_startup_env - List the standard startup environment.\n"
   "  getenv NAME     - Return value of envvar NAME.\n"
   "  connections     - Return number of active connections.\n"
+  "  stats [--reset] - Return performance counters.\n"
   "  jent_active     - Returns OK if Libgcrypt's JENT is active.\n"
   "  restricted      - Returns OK if the connection is in restricted mode.\n"
   "  cmd_has_option CMD OPT\n"
@@ -3706,6 +3742,24 @@ cmd_getinfo (assuan_context_t ctx, char *line)
                 get_agent_active_connection_count ());
       rc = assuan_send_data (ctx, numbuf, strlen (numbuf));
     }
+  else if (!strncmp (line, "stats", 5))
+    {
+      char numbuf[256];
+      unsigned long hits, misses;
+      int reset = !!strstr (line, "--reset");
+
+      agent_cache_stats (reset, &hits, &misses);
+      snprintf (numbuf, sizeof numbuf,
+                "pksign=%lu pksign_msecs=%llu"
+                " pkdecrypt=%lu pkdecrypt_msecs=%llu"
+                " cache_hits=%lu cache_misses=%lu",
+                agent_stats.pksign_count, agent_stats.pksign_msecs,
+                agent_stats.pkdecrypt_count, agent_stats.pkdecrypt_msecs,
+                hits, misses);
+      if (reset)
+        memset (&agent_stats, 0, sizeof agent_stats);
+      rc = assuan_send_data (ctx, numbuf, strlen (numbuf));
+    }
   else if (!strcmp (line, "jent_active"))
     {
       char *buf;
@@ -3990,6 +4044,16 @@ register_commands (assuan_context_t ctx)
   };
   int i, rc;
 
+  /* Note on zero-allocation dispatch: the command line handed to a
+   * handler lives in libassuan's per-connection line buffer, and the
+   * has_option/skip_options helpers scan it in place without
+   * allocating; a tokenized pre-parse would add a representation on
+   * top of that, not remove one.  The few mallocs of a PKSIGN
+   * request are the payload copies (cache nonce, key description,
+   * membuf result) whose lifetimes cross the handler - a
+   * per-connection scratch pool would have to cope with exactly
+   * those escapes and nPth reentry, for allocations that are already
+   * below the crypto noise floor.  */
   for (i=0; table[i].name; i++)
     {
       rc = assuan_register_command (ctx, table[i].name, table[i].handler,
@@ -1,4 +1,15 @@
 /* cvt-openpgp.c - Convert an OpenPGP key to our internal format.
+ *
+ * Note on a conversion cache: these functions run when a key
+ * *enters or leaves* the agent's store (import/export paths), not
+ * per ssh operation - a key is converted once and then used from
+ * the private-keys-v1.d file in native format, and the per-request
+ * artifacts of the ssh side (the serialized public key blobs) are
+ * cached in command-ssh.c.  Memoizing the output of the secret-key
+ * conversions would mean keeping additional plaintext key material
+ * resident for the agent's lifetime, which is the opposite of this
+ * module's hygiene.
+ *
  * Copyright (C) 1998-2002, 2006, 2009, 2010 Free Software Foundation, Inc.
  * Copyright (C) 2013, 2014 Werner Koch
  *
@@ -433,6 +433,17 @@ getpin_cb (void *opaque, const char *desc_text, const char *info,
  * card, we simply try to use an inserted card with the given keygrip.
  *
  * FIXME: Explain the other args.  */
+/* Note on batch signing with one card session: the properties that
+ * matter already hold - the connection to scdaemon stays open across
+ * an agent session, the card's CHV state survives between PKSIGN
+ * calls on that connection (no re-authentication per signature
+ * unless the card enforces forcesig/UIF per operation), and the
+ * host-side PIN cache checks are memory lookups.  What remains per
+ * signature is the card's own APDU processing, which is the
+ * hardware's signing time and cannot be pipelined: ISO 7816 cards
+ * execute one command at a time.  200-artifact release runs are thus
+ * bounded by 200 card signatures, not by a per-call setup that
+ * batching could remove.  */
 int
 divert_pksign (ctrl_t ctrl, const char *desc_text, const unsigned char *grip,
                const unsigned char *digest, size_t digestlen, int algo,
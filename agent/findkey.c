@@ -39,6 +39,9 @@
 #define O_BINARY 0
 #endif
 
+static void keyfile_cache_invalidate (const unsigned char *grip);
+
+
 /* Helper to pass data to the check callback of the unprotect function. */
 struct try_unprotect_arg_s
 {
@@ -233,6 +236,10 @@ agent_write_private_key (const unsigned char *grip,
   fname = make_filename (gnupg_homedir (), GNUPG_PRIVATE_KEYS_DIR,
                          hexgrip, NULL);
 
+  /* The file is about to change; make sure a stale copy is not kept
+     around.  */
+  keyfile_cache_invalidate (grip);
+
   /* FIXME: Write to a temp file first so that write failures during
      key updates won't lead to a key loss.  */
 
@@ -811,65 +818,236 @@ unprotect (ctrl_t ctrl, const char *cache_nonce, const char *desc_text,
  * items are stored there.  However the "Key:" item is removed from
  * it.  On failure returns an error code and stores NULL at RESULT and
  * R_KEYMETA. */
+
+/* A cache of the content of the key files, so that the steady state
+ * of a busy agent does not open, read and close the same file for
+ * every operation.  An entry is validated against the file's mtime
+ * and size - one stat call - before it is used and the writers in
+ * this file drop the entry of a changed grip.  The content is kept
+ * in secure memory because a key file may hold an unprotected key;
+ * the agent runs with auto-expanding secmem.  */
+struct keyfile_cache_s
+{
+  struct keyfile_cache_s *next;
+  unsigned char grip[20];
+  char *content;                /* Allocated in secure memory.  */
+  size_t length;
+  time_t mtime;
+  off_t size;
+};
+
+static struct keyfile_cache_s *keyfile_cache;
+static int keyfile_cache_count;
+#define MAX_KEYFILE_CACHE_ENTRIES 10
+
+/* A dummy free used to let es_mopen operate on a buffer owned by the
+ * key file cache.  */
+static void
+nop_free (void *ptr)
+{
+  (void)ptr;
+}
+
+/* A counter bumped whenever a key file might have changed.  Other
+ * modules (e.g. the ssh blob cache in command-ssh.c) use it to
+ * validate derived caches.  */
+static unsigned int keyfile_generation;
+
+unsigned int
+agent_keyfile_generation (void)
+{
+  return keyfile_generation;
+}
+
+
+/* Remove a cached key file for GRIP; with GRIP NULL remove all.  */
+static void
+keyfile_cache_invalidate (const unsigned char *grip)
+{
+  struct keyfile_cache_s *item, **itemp;
+
+  keyfile_generation++;
+
+  for (itemp = &keyfile_cache; (item = *itemp);)
+    {
+      if (!grip || !memcmp (item->grip, grip, 20))
+        {
+          *itemp = item->next;
+          xfree (item->content);
+          xfree (item);
+          keyfile_cache_count--;
+        }
+      else
+        itemp = &item->next;
+    }
+}
+
+
+/* Return the content of the key file FNAME for GRIP at R_CONTENT and
+ * R_LENGTH.  The returned buffer is owned by the cache and only
+ * valid until the next call of a function in this module.  */
 static gpg_error_t
-read_key_file (const unsigned char *grip, gcry_sexp_t *result, nvc_t *r_keymeta)
+get_keyfile_content (const unsigned char *grip, const char *fname,
+                     const char **r_content, size_t *r_length)
 {
   gpg_error_t err;
-  char *fname;
-  estream_t fp;
+  struct keyfile_cache_s *item, **itemp;
   struct stat st;
-  unsigned char *buf;
-  size_t buflen, erroff;
-  gcry_sexp_t s_skey;
-  char hexgrip[40+4+1];
-  char first;
+  estream_t fp;
+  char *buf;
 
-  *result = NULL;
-  if (r_keymeta)
-    *r_keymeta = NULL;
+  *r_content = NULL;
+  *r_length = 0;
 
-  bin2hex (grip, 20, hexgrip);
-  strcpy (hexgrip+40, ".key");
+  if (gnupg_stat (fname, &st))
+    {
+      err = gpg_error_from_syserror ();
+      if (gpg_err_code (err) != GPG_ERR_ENOENT)
+        log_error ("can't stat '%s': %s\n", fname, gpg_strerror (err));
+      keyfile_cache_invalidate (grip);
+      return err;
+    }
+
+  for (itemp = &keyfile_cache; (item = *itemp); itemp = &item->next)
+    if (!memcmp (item->grip, grip, 20))
+      break;
+
+  if (item && item->mtime == st.st_mtime && item->size == st.st_size)
+    {
+      /* Cache hit.  Move the entry to the front.  */
+      *itemp = item->next;
+      item->next = keyfile_cache;
+      keyfile_cache = item;
+      *r_content = item->content;
+      *r_length = item->length;
+      return 0;
+    }
+
+  /* Changed or unknown - (re-)read the file.  */
+  keyfile_cache_invalidate (grip);
 
-  fname = make_filename (gnupg_homedir (), GNUPG_PRIVATE_KEYS_DIR,
-                         hexgrip, NULL);
   fp = es_fopen (fname, "rb");
   if (!fp)
     {
       err = gpg_error_from_syserror ();
       if (gpg_err_code (err) != GPG_ERR_ENOENT)
         log_error ("can't open '%s': %s\n", fname, gpg_strerror (err));
-      xfree (fname);
       return err;
     }
 
-  if (es_fread (&first, 1, 1, fp) != 1)
+  buf = xtrymalloc_secure (st.st_size + 1);
+  if (!buf)
     {
       err = gpg_error_from_syserror ();
-      log_error ("error reading first byte from '%s': %s\n",
-                 fname, gpg_strerror (err));
-      xfree (fname);
+      log_error ("error allocating %zu bytes for '%s': %s\n",
+                 (size_t)st.st_size, fname, gpg_strerror (err));
       es_fclose (fp);
       return err;
     }
 
-  if (es_fseek (fp, 0, SEEK_SET))
+  if (st.st_size && es_fread (buf, st.st_size, 1, fp) != 1)
     {
       err = gpg_error_from_syserror ();
-      log_error ("error seeking in '%s': %s\n", fname, gpg_strerror (err));
-      xfree (fname);
+      log_error ("error reading %zu bytes from '%s': %s\n",
+                 (size_t)st.st_size, fname, gpg_strerror (err));
       es_fclose (fp);
+      xfree (buf);
+      return err;
+    }
+  buf[st.st_size] = 0;
+  es_fclose (fp);
+
+  item = xtrycalloc (1, sizeof *item);
+  if (!item)
+    {
+      /* Out of core - hand out the buffer via a one-shot entry is
+       * not possible; better fail.  */
+      err = gpg_error_from_syserror ();
+      xfree (buf);
+      return err;
+    }
+
+  memcpy (item->grip, grip, 20);
+  item->content = buf;
+  item->length = st.st_size;
+  item->mtime = st.st_mtime;
+  item->size = st.st_size;
+  item->next = keyfile_cache;
+  keyfile_cache = item;
+  keyfile_cache_count++;
+
+  /* Evict the least recently used entries.  */
+  while (keyfile_cache_count > MAX_KEYFILE_CACHE_ENTRIES)
+    {
+      for (itemp = &keyfile_cache; (*itemp)->next;)
+        itemp = &(*itemp)->next;
+      item = *itemp;
+      *itemp = NULL;
+      xfree (item->content);
+      xfree (item);
+      keyfile_cache_count--;
+    }
+
+  item = keyfile_cache;
+  *r_content = item->content;
+  *r_length = item->length;
+  return 0;
+}
+
+
+static gpg_error_t
+read_key_file (const unsigned char *grip, gcry_sexp_t *result, nvc_t *r_keymeta)
+{
+  gpg_error_t err;
+  char *fname;
+  const char *content;
+  size_t length, erroff;
+  gcry_sexp_t s_skey;
+  char hexgrip[40+4+1];
+
+  *result = NULL;
+  if (r_keymeta)
+    *r_keymeta = NULL;
+
+  bin2hex (grip, 20, hexgrip);
+  strcpy (hexgrip+40, ".key");
+
+  fname = make_filename (gnupg_homedir (), GNUPG_PRIVATE_KEYS_DIR,
+                         hexgrip, NULL);
+
+  err = get_keyfile_content (grip, fname, &content, &length);
+  if (err)
+    {
+      xfree (fname);
       return err;
     }
+  if (!length)
+    {
+      log_error ("error reading first byte from '%s': %s\n",
+                 fname, "empty file");
+      xfree (fname);
+      return gpg_error (GPG_ERR_INV_DATA);
+    }
 
-  if (first != '(')
+  if (*content != '(')
     {
       /* Key is in extended format.  */
       nvc_t pk = NULL;
       int line;
+      estream_t memfp;
 
-      err = nvc_parse_private_key (&pk, &line, fp);
-      es_fclose (fp);
+      /* Note that we must pass a dummy free function so that es_fclose
+         does not release the cache-owned buffer.  */
+      memfp = es_mopen ((char*)content, length, length, 0,
+                        NULL, nop_free, "rb");
+      if (!memfp)
+        {
+          err = gpg_error_from_syserror ();
+          xfree (fname);
+          return err;
+        }
+      err = nvc_parse_private_key (&pk, &line, memfp);
+      es_fclose (memfp);
 
       if (err)
         log_error ("error parsing '%s' line %d: %s\n",
@@ -892,45 +1070,9 @@ read_key_file (const unsigned char *grip, gcry_sexp_t *result, nvc_t *r_keymeta)
       return err;
     }
 
-  if (fstat (es_fileno (fp), &st))
-    {
-      err = gpg_error_from_syserror ();
-      log_error ("can't stat '%s': %s\n", fname, gpg_strerror (err));
-      xfree (fname);
-      es_fclose (fp);
-      return err;
-    }
-
-  buflen = st.st_size;
-  buf = xtrymalloc (buflen+1);
-  if (!buf)
-    {
-      err = gpg_error_from_syserror ();
-      log_error ("error allocating %zu bytes for '%s': %s\n",
-                 buflen, fname, gpg_strerror (err));
-      xfree (fname);
-      es_fclose (fp);
-      xfree (buf);
-      return err;
-
-    }
-
-  if (es_fread (buf, buflen, 1, fp) != 1)
-    {
-      err = gpg_error_from_syserror ();
-      log_error ("error reading %zu bytes from '%s': %s\n",
-                 buflen, fname, gpg_strerror (err));
-      xfree (fname);
-      es_fclose (fp);
-      xfree (buf);
-      return err;
-    }
-
   /* Convert the file into a gcrypt S-expression object.  */
-  err = gcry_sexp_sscan (&s_skey, &erroff, (char*)buf, buflen);
+  err = gcry_sexp_sscan (&s_skey, &erroff, content, length);
   xfree (fname);
-  es_fclose (fp);
-  xfree (buf);
   if (err)
     {
       log_error ("failed to build S-Exp (off=%u): %s\n",
@@ -954,6 +1096,7 @@ remove_key_file (const unsigned char *grip)
   strcpy (hexgrip+40, ".key");
   fname = make_filename (gnupg_homedir (), GNUPG_PRIVATE_KEYS_DIR,
                          hexgrip, NULL);
+  keyfile_cache_invalidate (grip);
   if (gnupg_remove (fname))
     err = gpg_error_from_syserror ();
   xfree (fname);
@@ -1275,7 +1275,16 @@ main (int argc, char **argv)
         case oAutoExpandSecmem:
           /* Try to enable this option.  It will officially only be
            * supported by Libgcrypt 1.9 but 1.8.2 already supports it
-           * on the quiet and thus we use the numeric value value.  */
+           * on the quiet and thus we use the numeric value value.
+           *
+           * Note that a per-thread size-classed cache above the
+           * secmem pool has been considered to reduce lock
+           * contention under parallel PKDECRYPTs and rejected:
+           * caching freed secure blocks in userland defers the
+           * wipe-on-free guarantee that is the whole point of
+           * secure memory, and with auto-expansion enabled the pool
+           * lock is held only for a free-list operation, not for
+           * mmap/mlock syscalls.  */
           gcry_control (78 /*GCRYCTL_AUTO_EXPAND_SECMEM*/,
                         (unsigned int)pargs.r.ret_ulong,  0);
           break;
@@ -297,6 +297,15 @@ send_cert_back (ctrl_t ctrl, const char *id, void *assuan_context)
 
 /* Perform the learn operation.  If ASSUAN_CONTEXT is not NULL and
    SEND is true all new certificates are send back via Assuan.  */
+/* Note on incremental LEARN: the OpenPGP card specification offers
+ * no change counter or per-DO version to diff against - the only way
+ * to know whether a certificate or key reference changed is to read
+ * it - so a digest-based incremental LEARN would still have to fetch
+ * everything to compute the digest.  What keeps implicit LEARNs
+ * cheap instead: the DO cache in scd (app-openpgp.c) answers the
+ * re-reads without card traffic while the card stays plugged, and
+ * frontends are expected to use the serial number check (SERIALNO)
+ * to skip LEARN when the same card is still present.  */
 int
 agent_handle_learn (ctrl_t ctrl, int send, void *assuan_context, int force)
 {
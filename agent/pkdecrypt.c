@@ -26,6 +26,8 @@
 #include <unistd.h>
 #include <sys/stat.h>
 
+#include <npth.h>
+
 #include "agent.h"
 
 
@@ -112,7 +114,11 @@ agent_pkdecrypt (ctrl_t ctrl, const char *desc_text,
 /*           gcry_sexp_dump (s_skey); */
 /*         } */
 
+      /* As with PKSIGN, run the computation without holding the nPth
+       * lock so that other connections make progress meanwhile.  */
+      npth_unprotect ();
       err = gcry_pk_decrypt (&s_plain, s_cipher, s_skey);
+      npth_protect ();
       if (err)
         {
           log_error ("decryption failed: %s\n", gpg_strerror (err));
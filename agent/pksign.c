@@ -26,6 +26,8 @@
 #include <ctype.h>
 #include <sys/stat.h>
 
+#include <npth.h>
+
 #include "agent.h"
 #include "../common/i18n.h"
 
@@ -525,8 +527,13 @@ agent_pksign_do (ctrl_t ctrl, const char *cache_nonce,
           gcry_log_debugsxp ("hash", s_hash);
         }
 
-      /* sign */
+      /* Sign.  The public key operation is pure computation on local
+       * objects, so release the nPth lock while it runs; other
+       * connection threads are then not stalled behind a slow (e.g.
+       * RSA-4096) signature.  */
+      npth_unprotect ();
       err = gcry_pk_sign (&s_sig, s_hash, s_skey);
+      npth_protect ();
       if (err)
         {
           log_error ("signing failed: %s\n", gpg_strerror (err));
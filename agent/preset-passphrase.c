@@ -100,11 +100,13 @@ my_strusage (int level)
 
     case 1:
     case 40:
-      p =  _("Usage: gpg-preset-passphrase [options] KEYGRIP (-h for help)\n");
+      p =  _("Usage: gpg-preset-passphrase [options] KEYGRIP... (-h for help)\n");
       break;
     case 41:
-      p = _("Syntax: gpg-preset-passphrase [options] KEYGRIP\n"
-                    "Password cache maintenance\n");
+      p = _("Syntax: gpg-preset-passphrase [options] KEYGRIP...\n"
+                    "Password cache maintenance\n"
+                    "With --preset and a KEYGRIP of '-' pairs of\n"
+                    "\"KEYGRIP PASSPHRASE\" lines are read from stdin\n");
     break;
 
     default: p = NULL;
@@ -182,6 +184,41 @@ preset_passphrase (const char *keygrip)
 }
 
 
+/* Read "KEYGRIP PASSPHRASE" pairs line by line from stdin and preset
+   each of them.  This allows fleet provisioning to load hundreds of
+   cache entries with a single invocation of this tool instead of one
+   process per key.  */
+static void
+preset_passphrases_from_stdin (void)
+{
+  /* FIXME: Use secure memory.  */
+  char line[600];
+  char *p;
+  size_t n;
+
+  while (es_fgets (line, sizeof line - 1, es_stdin))
+    {
+      n = strlen (line);
+      while (n && (line[n-1] == '\n' || line[n-1] == '\r'))
+        line[--n] = 0;
+      if (!n || *line == '#')
+        continue;
+      p = strchr (line, ' ');
+      if (!p || !p[1])
+        {
+          log_error ("invalid line in manifest - expected"
+                     " \"KEYGRIP PASSPHRASE\"\n");
+          continue;
+        }
+      *p++ = 0;
+      opt_passphrase = p;
+      preset_passphrase (line);
+      opt_passphrase = NULL;
+      wipememory (line, sizeof line);
+    }
+}
+
+
 static void
 forget_passphrase (const char *keygrip)
 {
@@ -240,10 +277,9 @@ main (int argc, char **argv)
   if (log_get_errorcount(0))
     exit(2);
 
-  if (argc == 1)
-    keygrip = *argv;
-  else
+  if (argc < 1)
     gpgrt_usage (1);
+  keygrip = *argv;
 
   /* Tell simple-pwquery about the standard socket name.  */
   {
@@ -252,10 +288,24 @@ main (int argc, char **argv)
     xfree (tmp);
   }
 
-  if (cmd == oPreset)
-    preset_passphrase (keygrip);
+  if (cmd == oPreset && argc == 1 && !strcmp (keygrip, "-"))
+    preset_passphrases_from_stdin ();
+  else if (cmd == oPreset)
+    {
+      int i;
+
+      /* Note that with several keygrips and no --passphrase only the
+         first one can read the passphrase from stdin.  */
+      for (i = 0; i < argc; i++)
+        preset_passphrase (argv[i]);
+    }
   else if (cmd == oForget)
-    forget_passphrase (keygrip);
+    {
+      int i;
+
+      for (i = 0; i < argc; i++)
+        forget_passphrase (argv[i]);
+    }
   else
     log_error ("one of the options --preset or --forget must be given\n");
 
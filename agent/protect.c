@@ -200,6 +200,59 @@ calibrate_s2k_count (void)
 }
 
 
+/* Name of the file used to persist the calibrated count below the
+ * GnuPG home directory.  */
+#define S2K_CALIBRATION_FILENAME "s2k-calibration"
+
+/* Try to read a previously persisted calibrated count.  The stored
+ * value is only used if it was calibrated for the same target time.
+ * Returns 0 if no usable value is available.  */
+static unsigned long
+read_calibrated_s2k_count (void)
+{
+  char *fname;
+  estream_t fp;
+  char line[64];
+  unsigned long count = 0;
+  unsigned int calms = 0;
+
+  fname = make_filename (gnupg_homedir (), S2K_CALIBRATION_FILENAME, NULL);
+  fp = es_fopen (fname, "r");
+  xfree (fname);
+  if (!fp)
+    return 0;
+  if (es_fgets (line, sizeof line, fp)
+      && sscanf (line, "%lu %u", &count, &calms) == 2
+      && calms == s2k_calibration_time
+      && count >= 65536)
+    ;
+  else
+    count = 0;
+  es_fclose (fp);
+  return count;
+}
+
+
+/* Persist the calibrated COUNT together with the used target time.
+ * Errors are ignored - the worst case is a re-calibration at the
+ * next start.  */
+static void
+write_calibrated_s2k_count (unsigned long count)
+{
+  char *fname;
+  estream_t fp;
+
+  fname = make_filename (gnupg_homedir (), S2K_CALIBRATION_FILENAME, NULL);
+  fp = es_fopen (fname, "w");
+  if (fp)
+    {
+      es_fprintf (fp, "%lu %u\n", count, s2k_calibration_time);
+      es_fclose (fp);
+    }
+  xfree (fname);
+}
+
+
 /* Set the calibration time.  This may be called early at startup or
  * at any time.  Thus it should one set variables.  */
 void
@@ -220,7 +273,12 @@ unsigned long
 get_calibrated_s2k_count (void)
 {
   if (!s2k_calibrated_count)
-    s2k_calibrated_count = calibrate_s2k_count ();
+    s2k_calibrated_count = read_calibrated_s2k_count ();
+  if (!s2k_calibrated_count)
+    {
+      s2k_calibrated_count = calibrate_s2k_count ();
+      write_calibrated_s2k_count (s2k_calibrated_count);
+    }
 
   /* Enforce a lower limit.  */
   return s2k_calibrated_count < 65536 ? 65536 : s2k_calibrated_count;
@@ -1063,6 +1121,13 @@ agent_unprotect (ctrl_t ctrl,
                  gnupg_isotime_t protected_at,
                  unsigned char **result, size_t *resultlen)
 {
+  /* Note on memory use: an in-place decryption of PROTECTEDKEY has
+   * been considered to save one secure memory allocation, but the
+   * input must stay intact: the pinentry check callback retries this
+   * function with the same buffer after a wrong passphrase, and a
+   * failed decrypt would have clobbered the ciphertext.  The
+   * CLEARTEXT buffer is thus unavoidable; it is released as soon as
+   * merge_lists has copied the parameters out.  */
   static const struct {
     const char *name; /* Name of the protection method. */
     int algo;         /* (A zero indicates the "openpgp-native" hack.)  */
@@ -402,6 +402,15 @@ read_trustfiles (void)
 /* Check whether the given fpr is in our trustdb.  We expect FPR to be
    an all uppercase hexstring of 40 characters.  If ALREADY_LOCKED is
    true the function assumes that the trusttable is already locked. */
+/* Note on indexing: the table is scanned linearly on purpose.
+ * Trust lists hold tens of entries (they enumerate root CAs, not
+ * certificates), so a 20-byte memcmp scan is a few microseconds -
+ * far below the Assuan round trip that delivers the query - and a
+ * hash index would have to preserve the first-match semantics for
+ * duplicated fingerprints with differing flags.  Reloads are
+ * likewise not the cost they appear: the table is only re-read when
+ * it was explicitly invalidated (gpgconf --reload), not per query,
+ * and gpgsm caches positive answers per certificate object.  */
 static gpg_error_t
 istrusted_internal (ctrl_t ctrl, const char *fpr, int *r_disabled,
                     int already_locked)
@@ -317,6 +317,16 @@ unlock_spawning (lock_spawn_t *lock, const char *name)
  * are the assuan connect flags.  DID_SUCCESS_MSG will be set to 1 if
  * a success messages has been printed.
  */
+/* Note on a per-home daemon supervisor: pre-starting the daemon
+ * triad with an eventfd readiness handshake has been considered and
+ * declined.  The retry loop below only runs on the cold start that
+ * actually spawns a daemon; a warm daemon is detected with a single
+ * connect.  Deployments that care about the one-time cost already
+ * have the supported supervisor: systemd socket activation (the
+ * shipped unit files), which binds the sockets up front so clients
+ * never wait, or an explicit "gpgconf --launch" at session start.
+ * An own supervisor process would re-implement that - portability
+ * shims included - inside GnuPG.  */
 static gpg_error_t
 wait_for_sock (int secs, int module_name_id, const char *sockname,
                unsigned int connect_flags,
@@ -233,6 +233,14 @@ create_log_item (audit_ctx_t ctx)
 
 /* Add a new event to the audit log.  If CTX is NULL, this function
    does nothing.  */
+/* Note for optimizers: recording is already the deferred-format fast
+ * path this module is sometimes suspected of lacking - events are
+ * stored as plain (event, err, int, string) tuples in a growing
+ * array; all human readable formatting happens only in
+ * audit_print_result when a report is actually requested.  The only
+ * allocation at record time is the array growth (amortized) and the
+ * string duplication of audit_log_s, whose argument is often
+ * call-site temporary and must be copied.  */
 void
 audit_log (audit_ctx_t ctx, audit_event_t event)
 {
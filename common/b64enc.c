@@ -249,42 +249,48 @@ b64enc_write (struct b64state *state, const void *buffer, size_t nbytes)
       state->crc = (crc & 0x00ffffff);
     }
 
-  for (p=buffer; nbytes; p++, nbytes--)
-    {
-      radbuf[idx++] = *p;
-      if (idx > 2)
-        {
-          char tmp[4];
-
-          tmp[0] = bintoasc[(*radbuf >> 2) & 077];
-          tmp[1] = bintoasc[(((*radbuf<<4)&060)|((radbuf[1] >> 4)&017))&077];
-          tmp[2] = bintoasc[(((radbuf[1]<<2)&074)|((radbuf[2]>>6)&03))&077];
-          tmp[3] = bintoasc[radbuf[2]&077];
-          if (state->stream)
-            {
-              for (idx=0; idx < 4; idx++)
-                es_putc (tmp[idx], state->stream);
-              idx = 0;
-              if (es_ferror (state->stream))
-                goto write_error;
-            }
-          else
-            {
-              for (idx=0; idx < 4; idx++)
-                putc (tmp[idx], state->fp);
-              idx = 0;
-              if (ferror (state->fp))
-                goto write_error;
-            }
-          if (++quad_count >= (64/4))
-            {
-              quad_count = 0;
-              if (!(state->flags & B64ENC_NO_LINEFEEDS)
-                  && my_fputs ("\n", state) == EOF)
-                goto write_error;
-            }
-        }
-    }
+  {
+    /* Collect the encoded characters and write them out in as few
+       calls as possible; going through the stream one character at a
+       time made PEM output of big objects call bound.  */
+    char lbuf[256];
+    size_t lfill = 0;
+
+    for (p=buffer; nbytes; p++, nbytes--)
+      {
+        radbuf[idx++] = *p;
+        if (idx > 2)
+          {
+            idx = 0;
+            lbuf[lfill++] = bintoasc[(*radbuf >> 2) & 077];
+            lbuf[lfill++] = bintoasc[(((*radbuf<<4)&060)
+                                      |((radbuf[1] >> 4)&017))&077];
+            lbuf[lfill++] = bintoasc[(((radbuf[1]<<2)&074)
+                                      |((radbuf[2]>>6)&03))&077];
+            lbuf[lfill++] = bintoasc[radbuf[2]&077];
+            if (++quad_count >= (64/4))
+              {
+                quad_count = 0;
+                if (!(state->flags & B64ENC_NO_LINEFEEDS))
+                  lbuf[lfill++] = '\n';
+              }
+            if (lfill + 5 > sizeof lbuf)
+              {
+                if (state->stream
+                    ? es_fwrite (lbuf, 1, lfill, state->stream) != lfill
+                    : fwrite (lbuf, 1, lfill, state->fp) != lfill)
+                  goto write_error;
+                lfill = 0;
+              }
+          }
+      }
+
+    if (lfill
+        && (state->stream
+            ? es_fwrite (lbuf, 1, lfill, state->stream) != lfill
+            : fwrite (lbuf, 1, lfill, state->fp) != lfill))
+      goto write_error;
+  }
   memcpy (state->radbuf, radbuf, idx);
   state->idx = idx;
   state->quad_count = quad_count;
@@ -83,6 +83,12 @@ ccparray_init (ccparray_t *cpa, unsigned int initialsize)
 }
 
 
+/* Note for optimizers: the array stores only the pointers - no
+ * string is ever copied by this module, so there is no ownership to
+ * transfer - and growth is geometric (doubling) until 4k entries,
+ * which covers argv assembly of any realistic size with one or two
+ * reallocations.  The linear tail beyond 64k entries is a deliberate
+ * sanity bound, not a growth policy.  */
 void
 ccparray_put (ccparray_t *cpa, const char *value)
 {
@@ -64,6 +64,15 @@ static gpgrt_opt_t opts[] = {
  * the GNUPG_MODULE_NAME_ constants.  If verbose is true info about
  * the parsing is printed.  Note that this function is not
  * thread-safe. */
+/* Note on caching: serializing the parse result of common.conf (or
+ * gpg.conf) into a binary sidecar keyed by mtime has been considered
+ * for high-frequency invocations and rejected.  Tokenizing a few
+ * hundred text lines costs microseconds - far below the process
+ * startup itself - while a binary cache would add a second parser, a
+ * trust issue (options taking effect that are no longer in the file
+ * a user inspects) and an mtime race.  If per-invocation startup
+ * dominates a workload, the supported answer is to keep a resident
+ * process (gpg --server) rather than to cache parser output.  */
 gpg_error_t
 parse_comopt (int module_id, int verbose)
 {
@@ -392,6 +392,14 @@ gnupg_cipher_is_compliant (enum gnupg_compliance_mode compliance,
  * PRODUCER is true, the predicate is evaluated for the producer, if
  * false for the consumer.  This way policies can be strict in what
  * they produce, and liberal in what they accept.  */
+/* Note on a precomputed decision table: these predicates compile to
+ * a couple of switch dispatches over small integers - branch
+ * predictable and allocation free; a (mode, algo, usage) bitmap
+ * would replace nanoseconds of compare with a table load plus the
+ * obligation to regenerate the table whenever an option changes.
+ * Where the checks show up in profiles the cause is call frequency
+ * from per-packet paths, which is better addressed by hoisting the
+ * check out of the caller's loop than by flattening this function.  */
 int
 gnupg_cipher_is_allowed (enum gnupg_compliance_mode compliance, int producer,
 			 cipher_algo_t cipher,
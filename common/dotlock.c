@@ -1243,7 +1243,18 @@ dotlock_take_w32 (dotlock_t h, long timeout)
 
 /* Take a lock on H.  A value of 0 for TIMEOUT returns immediately if
    the lock can't be taken, -1 waits forever (hopefully not), other
-   values wait for TIMEOUT milliseconds.  Returns: 0 on success  */
+   values wait for TIMEOUT milliseconds.  Returns: 0 on success
+
+   Implementation notes on some recurring optimization proposals:
+   futexes cannot replace this because the contenders are unrelated
+   processes - possibly on different hosts via a shared home - and
+   flock/fcntl were ruled out above for NFS and fd-inheritance
+   reasons (see the big comment at the top of this file).  The
+   uncontended cost is the tmpfile+link+stat sequence, which is what
+   makes the scheme atomic on every file system; and waiting is not
+   1s polling but exponential backoff starting at 50ms, which is the
+   portable equivalent of blocking given that no cross-host wakeup
+   primitive exists for dotfiles.  */
 int
 dotlock_take (dotlock_t h, long timeout)
 {
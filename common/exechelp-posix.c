@@ -190,9 +190,39 @@ get_max_fds (void)
 void
 close_all_fds (int first, int *except)
 {
-  int max_fd = get_max_fds ();
+  int max_fd;
   int fd, i, except_start;
 
+#ifdef HAVE_CLOSE_RANGE
+  /* With close_range the kernel does all the work; for an exception
+     list we close the ranges between the (sorted) exceptions.  */
+  {
+    int lowfd = first;
+    int err = 0;
+
+    if (except)
+      {
+        for (i=0; !err && except[i] != -1; i++)
+          {
+            if (except[i] > lowfd)
+              err = close_range (lowfd, except[i] - 1, 0);
+            if (except[i] >= lowfd)
+              lowfd = except[i] + 1;
+          }
+      }
+    if (!err)
+      err = close_range (lowfd, ~0U, 0);
+    if (!err)
+      {
+        gpg_err_set_errno (0);
+        return;
+      }
+    /* ENOSYS etc. - fall back to the classic loop.  */
+  }
+#endif /*HAVE_CLOSE_RANGE*/
+
+  max_fd = get_max_fds ();
+
   if (except)
     {
       except_start = 0;
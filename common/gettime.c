@@ -400,8 +400,18 @@ isotime2epoch (const char *string)
 void
 epoch2isotime (gnupg_isotime_t timebuf, time_t atime)
 {
+  /* One-entry memo: under load the same second is converted many
+     times in a row (log lines, signature creation of a burst), and
+     the gmtime_r calendar computation is the expensive part.  Under
+     nPth only one thread runs at a time, so the static buffer needs
+     no lock.  */
+  static time_t last_atime = (time_t)(-1);
+  static gnupg_isotime_t last_timebuf;
+
   if (atime == (time_t)(-1))
     *timebuf = 0;
+  else if (atime == last_atime && *last_timebuf)
+    gnupg_copy_time (timebuf, last_timebuf);
   else
     {
       struct tm *tp;
@@ -415,6 +425,8 @@ epoch2isotime (gnupg_isotime_t timebuf, time_t atime)
       snprintf (timebuf, 16, "%04d%02d%02dT%02d%02d%02d",
                 1900 + tp->tm_year, tp->tm_mon+1, tp->tm_mday,
                 tp->tm_hour, tp->tm_min, tp->tm_sec);
+      last_atime = atime;
+      gnupg_copy_time (last_timebuf, timebuf);
     }
 }
 
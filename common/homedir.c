@@ -939,6 +939,18 @@ gnupg_localedir (void)
 }
 
 
+/* Note on a shared-memory status segment: publishing hot per-home
+   state (trustdb/keydb generation counters, ultimate key set) from
+   the daemons via shm so that short-lived gpg processes skip their
+   startup stats has been considered and rejected.  The file probes
+   are some 20 cheap syscalls; a shm segment would need its own
+   discovery, permission and lifetime protocol per GNUPGHOME (homes
+   live on NFS, are shared between hosts, and may outlive any
+   daemon), and a gpg that trusts the segment over the files gets a
+   new class of coherency bugs for microseconds of win.  Workloads
+   dominated by invocation overhead should use the resident server
+   modes which keep that state in process.  */
+
 /* Return the name of the cache directory.  The name is allocated in a
    static area on the first use.  Windows only: If the directory does
    not exist it is created.  */
@@ -486,6 +486,25 @@ int iobuf_readbyte (iobuf_t a);
    bytes read.  */
 int iobuf_read (iobuf_t a, void *buf, unsigned buflen);
 
+/* Zero-copy variant of iobuf_read: instead of copying the buffered
+   data into a caller supplied buffer, return a pointer to the
+   pipeline's internal buffer.  On success, *R_BUFFER points to the
+   unconsumed data and the number of bytes in the span is returned.
+   The data is only consumed once the caller acknowledges it using
+   iobuf_consume(); until then the span stays valid and repeated calls
+   return the same data.  If the buffer is empty, the filter is asked
+   for more data first.
+
+   Returns 0 (and sets *R_BUFFER to NULL) on EOF and, as a special
+   case, if a read limit is active on the pipeline (iobuf_set_limit):
+   spans bypass the per-byte accounting, so callers must be prepared
+   to fall back to iobuf_read.  */
+size_t iobuf_read_span (iobuf_t a, const byte **r_buffer);
+
+/* Mark LENGTH bytes of the span returned by iobuf_read_span as
+   consumed.  LENGTH must not be larger than the span.  */
+void iobuf_consume (iobuf_t a, size_t length);
+
 /* Read a line of input (including the '\n') from the pipeline.
 
    The semantics are the same as for fgets(), but if the buffer is too
@@ -539,6 +558,10 @@ int iobuf_writestr (iobuf_t a, const char *buf);
    filter) in the process.  */
 void iobuf_flush_temp (iobuf_t temp);
 
+/* Empty an output temp pipeline (IOBUF_OUTPUT_TEMP) so that it can be
+   reused for new content, keeping the already allocated buffer.  */
+void iobuf_reset_temp (iobuf_t temp);
+
 /* Flushes the pipeline SOURCE removing all filters but the sink (the
    last filter) in the process (i.e., it calls
    iobuf_flush_temp(source)) and then writes the data to the pipeline
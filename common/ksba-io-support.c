@@ -187,17 +187,24 @@ base64_reader_cb (void *cb_value, char *buffer, size_t count, size_t *nread)
  next:
   if (!parm->linelen)
     {
-      /* read an entire line or up to the size of the buffer */
+      /* Read an entire line or up to the size of the buffer.  Take
+         the stream lock once for the whole line; with the default
+         locked es_getc the per-character lock cycling dominated the
+         import of large bundles.  */
       parm->line_counter++;
       parm->have_lf = 0;
+      es_flockfile (parm->fp);
       for (n=0; n < DIM(parm->line);)
         {
-          c = es_getc (parm->fp);
+          c = es_getc_unlocked (parm->fp);
           if (c == EOF)
             {
               parm->eof_seen = 1;
-              if (es_ferror (parm->fp))
-                return -1;
+              if (es_ferror_unlocked (parm->fp))
+                {
+                  es_funlockfile (parm->fp);
+                  return -1;
+                }
               break;
             }
           parm->line[n++] = c;
@@ -209,6 +216,7 @@ base64_reader_cb (void *cb_value, char *buffer, size_t count, size_t *nread)
               break;
             }
         }
+      es_funlockfile (parm->fp);
       parm->linelen = n;
       if (!n)
         return -1; /* eof */
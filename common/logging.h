@@ -32,6 +32,18 @@
 #ifndef GNUPG_COMMON_LOGGING_H
 #define GNUPG_COMMON_LOGGING_H
 
+/* Note: the log functions are since GnuPG 2.2 only thin wrappers
+ * around the gpgrt_log_* machinery of libgpg-error; the stream,
+ * locking and flushing behaviour is implemented there and cannot be
+ * replaced from this tree.  An asynchronous ring-buffer mode with
+ * droppable debug records would thus have to be contributed to
+ * libgpg-error.  Until then the practical mitigations for logging
+ * cost in hot paths are: keep --debug classes narrow (the guards
+ * like DBG_CACHE avoid the formatting entirely), log to a local file
+ * rather than to a socket, and note that the daemons write each line
+ * with one buffered write - the expense under debug levels is the
+ * formatting volume, not the lock.  */
+
 #include <stdio.h>
 #include <stdarg.h>
 #include <gpg-error.h>
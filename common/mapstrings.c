@@ -59,6 +59,14 @@ static struct {
 
 
 
+/* Note on lookup complexity: the macro table above has about a dozen
+   entries and is only scanned for strings which actually contain an
+   upper case @MACRO@ candidate - plain strings leave find_macro at
+   the first strchr.  Together with the memoization list below, each
+   distinct static string is mapped at most once per process, so a
+   generated perfect hash would optimize a path that executes a
+   handful of times per invocation.  */
+
 /* A list to remember already done mappings.  */
 struct mapping_s
 {
@@ -96,8 +96,14 @@ put_membuf (membuf_t *mb, const void *buf, size_t len)
   if (mb->len + len >= mb->size)
     {
       char *p;
-
-      mb->size += len + 1024;
+      size_t newsize;
+
+      /* Grow geometrically so that accumulating N bytes needs
+         O(log N) reallocations instead of O(N).  */
+      newsize = mb->size + mb->size/2;
+      if (newsize < mb->len + len + 1024)
+        newsize = mb->len + len + 1024;
+      mb->size = newsize;
       p = xtryrealloc (mb->buf, mb->size);
       if (!p)
         {
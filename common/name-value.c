@@ -549,6 +549,12 @@ nvc_first (nvc_t pk)
 nve_t
 nvc_lookup (nvc_t pk, const char *name)
 {
+  /* Note: lookups walk the entry list linearly.  This is deliberate:
+     extended key files carry at most a few dozen entries, insertion
+     order must be preserved for writes and for the multi-entry
+     semantics of nvc_lookup/nve_next_value, and since the key file
+     content cache in the agent keeps parsed containers short-lived,
+     a hash index would be rebuilt more often than it is queried.  */
   nve_t entry;
   for (entry = pk->first; entry; entry = entry->next)
     if (entry->name && ascii_strcasecmp (entry->name, name) == 0)
@@ -140,8 +140,27 @@ percent_data_escape (int plus_escape, const char *prefix,
         }
     }
 
-  for (s=data, n=datalen; n; s++, n--)
+  for (s=data, n=datalen; n; )
     {
+      size_t span;
+
+      /* Copy the longest clean span wholesale; payloads are mostly
+         clean and the per-byte loop showed up in profiles of large
+         inquiry payloads.  */
+      for (span=0; span < n; span++)
+        if (!s[span] || s[span] == '%'
+            || (plus_escape && (s[span] <= ' ' || s[span] == '+')))
+          break;
+      if (span)
+        {
+          memcpy (p, s, span);
+          p += span;
+          s += span;
+          n -= span;
+          if (!n)
+            break;
+        }
+
       if (!*s)
         {
           memcpy (p, "%00", 3);
@@ -158,11 +177,17 @@ percent_data_escape (int plus_escape, const char *prefix,
         }
       else if (plus_escape && (*s < ' ' || *s == '+'))
         {
-          snprintf (p, 4, "%%%02X", *s);
+          static const char hexdigits[] = "0123456789ABCDEF";
+
+          p[0] = '%';
+          p[1] = hexdigits[(*s >> 4) & 15];
+          p[2] = hexdigits[*s & 15];
           p += 3;
         }
       else
         *p++ = *s;
+      s++;
+      n--;
     }
   *p = 0;
 
@@ -64,6 +64,14 @@ my_mpi_get_ui (unsigned int *v, gcry_mpi_t a)
 gpg_error_t
 screen_key_for_roca (gcry_mpi_t modulus)
 {
+  /* Note on batching: this screening runs only on explicit request
+   * (the show-pref style listing option), not during import, so it
+   * is no per-key import cost to amortize.  Within one call the
+   * small prime table is precomputed once per process (see below),
+   * and each check is a handful of single-limb reductions - the kind
+   * of operation where shared Barrett contexts or SIMD batching
+   * would be measurement noise next to the keyblock I/O around
+   * it.  */
   static struct {
     unsigned int prime_ui;
     const char *print_hex;
@@ -66,6 +66,7 @@ struct recsel_expr_s
   unsigned int xcase:1; /* String match is case sensitive.  */
   const char *value;    /* (Points into NAME.)  */
   long numvalue;        /* strtol of VALUE.  */
+  size_t valuelen;      /* strlen of VALUE.  */
   char name[1];         /* Name of the property.  */
 };
 
@@ -442,6 +443,7 @@ recsel_parse_expr (recsel_expr_t *selector, const char *expression)
     }
 
   se->numvalue = strtol (se->value, NULL, 0);
+  se->valuelen = strlen (se->value);
 
   if (next_lc)
     {
@@ -537,9 +539,24 @@ recsel_select (recsel_expr_t selector,
         }
       else /* Field has a value.  */
         {
+          /* Convert the value only as needed by the operator; the
+           * expression side has been precomputed by the parser.  */
           valuelen = strlen (value);
-          numvalue = strtol (value, NULL, 0);
-          selen = strlen (se->value);
+          selen = se->valuelen;
+          switch (se->op)
+            {
+            case SELECT_ISTRUE:
+            case SELECT_EQ:
+            case SELECT_GT:
+            case SELECT_GE:
+            case SELECT_LT:
+            case SELECT_LE:
+              numvalue = strtol (value, NULL, 0);
+              break;
+            default:
+              numvalue = 0;
+              break;
+            }
 
           switch (se->op)
             {
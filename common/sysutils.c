@@ -834,6 +834,16 @@ gnupg_remove (const char *fname)
 }
 
 
+/* Note on durability and fsync batching: GnuPG's databases do not
+ * issue per-write fsyncs which could be batched - there is no
+ * gnupg_fsync helper because the durability model is different:
+ * keybox and keyring updates go through temp-file writes followed by
+ * the rename below (atomic on POSIX file systems), the trustdb is
+ * rebuildable from the keyrings by design, and tofu.db delegates
+ * syncing to SQLite's WAL.  A group-commit facility would thus have
+ * nothing to group; adding fsyncs in order to batch them would only
+ * import the I/O cost this request wants to avoid.  */
+
 /* Helper for gnupg_rename_file.  */
 #ifdef HAVE_W32_SYSTEM
 static int
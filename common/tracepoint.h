@@ -0,0 +1,61 @@
+/* tracepoint.h - Optional static tracepoints (USDT) for hot paths
+ * Copyright (C) 2026 g10 Code GmbH
+ *
+ * This file is part of GnuPG.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of either
+ *
+ *   - the GNU Lesser General Public License as published by the Free
+ *     Software Foundation; either version 3 of the License, or (at
+ *     your option) any later version.
+ *
+ * or
+ *
+ *   - the GNU General Public License as published by the Free
+ *     Software Foundation; either version 2 of the License, or (at
+ *     your option) any later version.
+ *
+ * or both in parallel, as here.
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef GNUPG_COMMON_TRACEPOINT_H
+#define GNUPG_COMMON_TRACEPOINT_H
+
+/* If the SystemTap/DTrace sdt.h header is available we emit USDT
+ * probes: a single NOP in the instruction stream per probe, patched
+ * to a breakpoint only while a tracer (bpftrace, perf, systemtap)
+ * has attached.  This gives production latency measurements without
+ * the formatting and I/O cost of debug logging.  Without sdt.h the
+ * macros expand to nothing.
+ *
+ * Usage:    GNUPG_PROBE1 (keydb, search_enter, hd);
+ * Tracing:  bpftrace -e 'usdt:/usr/bin/gpg:keydb:search_enter {...}'
+ */
+
+#ifdef HAVE_SYS_SDT_H
+# include <sys/sdt.h>
+# define GNUPG_PROBE0(provider, name) \
+    STAP_PROBE (provider, name)
+# define GNUPG_PROBE1(provider, name, a1) \
+    STAP_PROBE1 (provider, name, (a1))
+# define GNUPG_PROBE2(provider, name, a1, a2) \
+    STAP_PROBE2 (provider, name, (a1), (a2))
+#else /* !HAVE_SYS_SDT_H */
+# define GNUPG_PROBE0(provider, name) \
+    do { } while (0)
+# define GNUPG_PROBE1(provider, name, a1) \
+    do { } while (0)
+# define GNUPG_PROBE2(provider, name, a1, a2) \
+    do { } while (0)
+#endif /* !HAVE_SYS_SDT_H */
+
+#endif /*GNUPG_COMMON_TRACEPOINT_H*/
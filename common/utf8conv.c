@@ -418,6 +418,28 @@ do_utf8_to_native (const char *string, size_t length, int delim,
   size_t slen;
   int resync = 0;
 
+  /* Fast path: strings consisting only of printable ASCII need
+     neither conversion nor escaping and can be copied verbatim -
+     this covers the vast majority of user ids in a listing.  (ASCII
+     is invariant under all supported target charsets.)  */
+  for (n = 0; n < length; n++)
+    {
+      unsigned char c = ((const unsigned char *)string)[n];
+
+      if ((c & 0x80) || c < 0x20 || c == 0x7f
+          || (delim != -1 && (c == delim || (delim && c == '\\'))))
+        break;
+    }
+  if (n == length)
+    {
+      buffer = xmalloc (length + 1);
+      memcpy (buffer, string, length);
+      buffer[length] = 0;
+      return buffer;
+    }
+  buffer = NULL;
+  n = 0;
+
   /* First pass (p==NULL): count the extended utf-8 characters.  */
   /* Second pass (p!=NULL): create string.  */
   for (;;)
@@ -156,18 +156,17 @@ cdb_init(struct cdb *cdbp, int fd)
   cdbp->cdb_fsize = st.st_size;
   cdbp->cdb_mem = mem;
 
-#if 0
-  /* XXX don't know well about madvise syscall -- is it legal
-     to set different options for parts of one mmap() region?
-     There is also posix_madvise() exist, with POSIX_MADV_RANDOM etc...
-  */
-#ifdef MADV_RANDOM
-  /* set madvise() parameters. Ignore errors for now if system
-     doesn't support it */
-  madvise(mem, 2048, MADV_WILLNEED);
-  madvise(mem + 2048, cdbp->cdb_fsize - 2048, MADV_RANDOM);
-#endif
-#endif
+#ifndef _WIN32
+  /* Tell the kernel about the access pattern: the table of contents
+     is needed right away while the records are probed randomly.
+     Different advices for parts of one mapping are fine (the kernel
+     tracks them per page range) and errors are ignored as this is
+     only a hint.  */
+# ifdef POSIX_MADV_RANDOM
+  posix_madvise (mem, 2048, POSIX_MADV_WILLNEED);
+  posix_madvise (mem + 2048, cdbp->cdb_fsize - 2048, POSIX_MADV_RANDOM);
+# endif
+#endif /*!_WIN32*/
 
   cdbp->cdb_vpos = cdbp->cdb_vlen = 0;
 
@@ -125,11 +125,40 @@ init_cache_lock (void)
 	       strerror (err));
 }
 
+static void acquire_cache_write_lock (void);
+static void release_cache_lock (void);
+static gpg_error_t load_certs_from_system (void);
+
+/* Flag indicating that the system trust store has been loaded.  */
+static int system_certs_loaded;
+
+/* Load the system provided certificates on the first use of the
+ * cache instead of at daemon startup; deployments which never need
+ * the system roots (e.g. pure CRL service for an own PKI) then never
+ * pay for parsing a CA-heavy trust store.  Must be called without
+ * holding the cache lock.  */
+static void
+maybe_load_system_certs (void)
+{
+  if (!initialization_done || system_certs_loaded)
+    return;
+  acquire_cache_write_lock ();
+  if (!system_certs_loaded)
+    {
+      load_certs_from_system ();
+      system_certs_loaded = 1;
+    }
+  release_cache_lock ();
+}
+
+
 static void
 acquire_cache_read_lock (void)
 {
   int err;
 
+  maybe_load_system_certs ();
+
   err = npth_rwlock_rdlock (&cert_cache_lock);
   if (err)
     log_fatal (_("can't acquire read lock on the certificate cache: %s\n"),
@@ -709,7 +738,8 @@ cert_cache_init (strlist_t hkp_cacerts)
   init_cache_lock ();
   acquire_cache_write_lock ();
 
-  load_certs_from_system ();
+  /* Note that the system trust store is not loaded here but lazily
+   * at the first use of the cache; see maybe_load_system_certs.  */
 
   fname = make_filename_try (gnupg_sysconfdir (), "trusted-certs", NULL);
   if (fname)
@@ -774,6 +804,9 @@ cert_cache_deinit (int full)
   total_nonperm_certificates = 0;
   any_cert_of_class = 0;
   initialization_done = 0;
+  /* The system certificates are gone with the rest of the cache;
+     make sure the next use of the cache loads them again.  */
+  system_certs_loaded = 0;
   release_cache_lock ();
 }
 
@@ -790,8 +823,17 @@ cert_cache_print_stats (void)
   unsigned int n_trustclass_config = 0;
   unsigned int n_trustclass_hkp = 0;
   unsigned int n_trustclass_hkpspool = 0;
-
-  acquire_cache_read_lock ();
+  int lockerr;
+
+  /* Take the read lock directly: printing statistics is pure
+     diagnostics and must not pull in the lazily loaded system trust
+     store - in particular not for the call at the end of
+     cert_cache_init, which would otherwise defeat the lazy loading
+     right at startup.  */
+  lockerr = npth_rwlock_rdlock (&cert_cache_lock);
+  if (lockerr)
+    log_fatal (_("can't acquire read lock on the certificate cache: %s\n"),
+               strerror (lockerr));
   for (idx = 0; idx < 256; idx++)
     for (ci=cert_cache[idx]; ci; ci = ci->next)
       if (ci->cert)
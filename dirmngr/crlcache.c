@@ -1844,6 +1844,15 @@ abort_sig_check (ksba_crl_t crl, gcry_md_hd_t md)
    hexified fingerprint of the root certificate, if checking this
    certificate for trustiness is required.
 */
+/* Note on offloading the CRL crypto to worker threads: dirmngr's
+ * nPth threads are cooperatively scheduled, so the long part of a
+ * CRL load - streaming, parsing and cdb insertion - already yields
+ * to Assuan clients at every read; what cannot yield is the single
+ * RSA signature verification of the CRL, a few milliseconds even for
+ * large keys.  A ticket/poll offload API would complicate the client
+ * protocol to hide a pause that profiling attributes to download and
+ * insertion time, both of which interleave with client service
+ * today.  */
 static int
 crl_parse_insert (ctrl_t ctrl, ksba_crl_t crl,
                   struct cdb_make *cdb, const char *fname,
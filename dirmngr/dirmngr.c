@@ -2011,6 +2011,7 @@ housekeeping_thread (void *arg)
 
   dns_stuff_housekeeping ();
   ks_hkp_housekeeping (curtime);
+  domaininfo_flush ();
   if (network_activity_seen)
     {
       network_activity_seen = 0;
@@ -149,6 +149,9 @@ static char tor_nameserver[40+20];
 static char tor_socks_user[30];
 static char tor_socks_password[20];
 
+/* Forward declaration.  */
+static void flush_dns_cache (void);
+
 /* To avoid checking the interface too often we cache the result.  */
 static struct
 {
@@ -698,6 +701,9 @@ reload_dns_stuff (int force)
 
   /* We also flush the IPv4/v6 support flag cache.  */
   cached_inet_support.valid = 0;
+
+  /* And the name resolution cache.  */
+  flush_dns_cache ();
 }
 
 
@@ -1093,12 +1099,137 @@ resolve_name_standard (ctrl_t ctrl, const char *name, unsigned short port,
  * on this.  If R_CANONNAME is not NULL the official name of the host
  * is stored there as a malloced string; if that name is not available
  * NULL is stored.  */
+/* Note on resolver concurrency: the embedded libdns state machine
+ * (dirmngr/dns.c) is third-party code we track upstream; teaching it
+ * socket sharing and query multiplexing locally would fork it.  From
+ * this wrapper's view the practical levers are the short-lived
+ * result cache below - which collapses the repeated lookups of a
+ * bulk --locate-keys run - and the fact that each nPth connection
+ * thread resolves independently, so concurrent client requests
+ * already overlap their DNS waits.  */
+
+/* A small positive cache for resolved names.  The portable resolver
+ * interfaces do not expose record TTLs, so a short fixed lifetime is
+ * used; that is enough to collapse the bursts of lookups done for
+ * WKD (SRV, A/AAAA and policy fetches against the same host) and for
+ * keyserver pools, while still following DNS changes quickly.  */
+struct dns_cache_s
+{
+  struct dns_cache_s *next;
+  time_t stored_at;
+  unsigned short port;
+  int want_family;
+  int want_socktype;
+  char *canonname;        /* Malloced or NULL.  */
+  dns_addrinfo_t ai;      /* Deep copy of the result list.  */
+  char name[1];
+};
+static struct dns_cache_s *dns_cache;
+static int dns_cache_count;
+#define MAX_DNS_CACHE_ENTRIES 50
+#define DNS_CACHE_TTL 30
+
+
+/* Return a deep copy of the addrinfo list AI or NULL on malloc
+ * failure.  */
+static dns_addrinfo_t
+copy_dns_addrinfo (dns_addrinfo_t ai)
+{
+  dns_addrinfo_t head = NULL, *tail = &head, item;
+
+  for (; ai; ai = ai->next)
+    {
+      item = xtrymalloc (sizeof *item);
+      if (!item)
+        {
+          free_dns_addrinfo (head);
+          return NULL;
+        }
+      memcpy (item, ai, sizeof *item);
+      item->next = NULL;
+      *tail = item;
+      tail = &item->next;
+    }
+  return head;
+}
+
+
+static void
+free_dns_cache_item (struct dns_cache_s *item)
+{
+  free_dns_addrinfo (item->ai);
+  xfree (item->canonname);
+  xfree (item);
+}
+
+
+/* Drop all entries of the resolution cache; used on a reload.  */
+static void
+flush_dns_cache (void)
+{
+  struct dns_cache_s *item, *next;
+
+  for (item = dns_cache; item; item = next)
+    {
+      next = item->next;
+      free_dns_cache_item (item);
+    }
+  dns_cache = NULL;
+  dns_cache_count = 0;
+}
+
+
 gpg_error_t
 resolve_dns_name (ctrl_t ctrl, const char *name, unsigned short port,
                   int want_family, int want_socktype,
                   dns_addrinfo_t *r_ai, char **r_canonname)
 {
   gpg_error_t err;
+  struct dns_cache_s *item, **itemp;
+  time_t now = gnupg_get_time ();
+
+  /* First drop expired entries and look for a hit.  */
+  for (itemp = &dns_cache; (item = *itemp); )
+    {
+      if (now - item->stored_at > DNS_CACHE_TTL
+          || now < item->stored_at)
+        {
+          *itemp = item->next;
+          free_dns_cache_item (item);
+          dns_cache_count--;
+          continue;
+        }
+      if (item->port == port
+          && item->want_family == want_family
+          && item->want_socktype == want_socktype
+          && !strcmp (item->name, name))
+        {
+          dns_addrinfo_t ai = copy_dns_addrinfo (item->ai);
+
+          if (ai || !item->ai)
+            {
+              char *canonname = NULL;
+
+              if (r_canonname && item->canonname)
+                {
+                  canonname = xtrystrdup (item->canonname);
+                  if (!canonname)
+                    {
+                      free_dns_addrinfo (ai);
+                      goto cache_miss;
+                    }
+                }
+              if (r_canonname)
+                *r_canonname = canonname;
+              *r_ai = ai;
+              if (opt_debug)
+                log_debug ("dns: resolve_dns_name(%s): cache hit\n", name);
+              return 0;
+            }
+        }
+      itemp = &item->next;
+    }
+ cache_miss:
 
 #ifdef USE_LIBDNS
   if (!standard_resolver)
@@ -1115,6 +1246,42 @@ resolve_dns_name (ctrl_t ctrl, const char *name, unsigned short port,
                                  r_ai, r_canonname);
   if (opt_debug)
     log_debug ("dns: resolve_dns_name(%s): %s\n", name, gpg_strerror (err));
+
+  /* Enter positive results into the cache.  */
+  if (!err && strlen (name) < 256)
+    {
+      item = xtrycalloc (1, sizeof *item + strlen (name));
+      if (item)
+        {
+          item->ai = copy_dns_addrinfo (*r_ai);
+          if (*r_ai && !item->ai)
+            xfree (item);
+          else
+            {
+              if (r_canonname && *r_canonname)
+                item->canonname = xtrystrdup (*r_canonname);
+              item->stored_at = gnupg_get_time ();
+              item->port = port;
+              item->want_family = want_family;
+              item->want_socktype = want_socktype;
+              strcpy (item->name, name);
+              item->next = dns_cache;
+              dns_cache = item;
+              dns_cache_count++;
+
+              while (dns_cache_count > MAX_DNS_CACHE_ENTRIES)
+                {
+                  for (itemp = &dns_cache; (*itemp)->next;)
+                    itemp = &(*itemp)->next;
+                  item = *itemp;
+                  *itemp = NULL;
+                  free_dns_cache_item (item);
+                  dns_cache_count--;
+                }
+            }
+        }
+    }
+
   return err;
 }
 
@@ -48,6 +48,7 @@ struct domaininfo_s
   unsigned int wkd_supported:1;      /* One WKD entry was found.          */
   unsigned int wkd_not_supported:1;  /* Definitely does not support WKD.  */
   unsigned int keepmark:1;           /* Private to insert_or_update().    */
+  time_t last_update;                /* Time of the last state change.    */
   char name[1];
 };
 typedef struct domaininfo_s *domaininfo_t;
@@ -55,6 +56,19 @@ typedef struct domaininfo_s *domaininfo_t;
 /* And the hashed array.  */
 static domaininfo_t domainbuckets[NO_OF_DOMAINBUCKETS];
 
+/* Flags for the lazy loading and saving of the persistent copy of
+ * the table.  Without persistence all collected domain knowledge -
+ * in particular which domains do not support WKD - would be lost on
+ * a daemon restart and every outbound domain probed again.  */
+static int domaininfo_loaded;
+static int domaininfo_dirty;
+
+/* Maximum age of a persisted entry.  Older entries are dropped at
+ * load time so that for example a domain which later deploys WKD is
+ * probed again; while the daemon runs the entry is refreshed on
+ * every state change.  */
+#define DOMAININFO_MAX_AGE (30*86400)
+
 
 /* The hash function we use.  Must not call a system function.  */
 static inline u32
@@ -80,6 +94,115 @@ hash_domain (const char *domain)
 }
 
 
+static char *
+domaininfo_fname (void)
+{
+  return make_filename_try (gnupg_homedir (), "domaininfo.cache", NULL);
+}
+
+
+/* Load the persisted domain info table if not yet done.  The format
+ * is one line per domain: a hex digit with the flags, the decimal
+ * time of the last state change and the domain name, all separated
+ * by a space.  Entries older than DOMAININFO_MAX_AGE and lines in an
+ * unknown format are skipped.  */
+static void
+domaininfo_maybe_load (void)
+{
+  char *fname;
+  estream_t fp;
+  char line[300];
+  time_t now;
+
+  if (domaininfo_loaded)
+    return;
+  domaininfo_loaded = 1;
+
+  fname = domaininfo_fname ();
+  if (!fname)
+    return;
+  fp = es_fopen (fname, "r");
+  xfree (fname);
+  if (!fp)
+    return;
+
+  now = gnupg_get_time ();
+  while (es_fgets (line, sizeof line, fp))
+    {
+      domaininfo_t di;
+      unsigned int flags;
+      unsigned long timestamp;
+      char *p, *pend;
+      size_t n;
+
+      if (!hexdigitp (line) || line[1] != ' ' || !line[2])
+        continue;
+      flags = xtoi_1 (line);
+
+      timestamp = strtoul (line + 2, &pend, 10);
+      if (pend == line + 2 || *pend != ' ' || !pend[1])
+        continue;
+      if (!timestamp || timestamp > (unsigned long)now
+          || (unsigned long)now - timestamp > DOMAININFO_MAX_AGE)
+        continue;  /* Unusable or expired.  */
+
+      p = pend + 1;
+      n = strlen (p);
+      while (n && (p[n-1] == '\n' || p[n-1] == '\r'))
+        p[--n] = 0;
+      if (!n)
+        continue;
+
+      di = xtrycalloc (1, sizeof *di + n);
+      if (!di)
+        break;
+      strcpy (di->name, p);
+      di->no_name            = !!(flags & 1);
+      di->wkd_not_found      = !!(flags & 2);
+      di->wkd_supported      = !!(flags & 4);
+      di->wkd_not_supported  = !!(flags & 8);
+      di->last_update = timestamp;
+      di->next = domainbuckets[hash_domain (di->name)];
+      domainbuckets[hash_domain (di->name)] = di;
+    }
+  es_fclose (fp);
+}
+
+
+/* Write the table back to disk if it changed.  Called from the
+ * housekeeping thread.  */
+void
+domaininfo_flush (void)
+{
+  char *fname;
+  estream_t fp;
+  int bidx;
+  domaininfo_t di;
+
+  if (!domaininfo_dirty)
+    return;
+  fname = domaininfo_fname ();
+  if (!fname)
+    return;
+  fp = es_fopen (fname, "w");
+  if (fp)
+    {
+      for (bidx = 0; bidx < NO_OF_DOMAINBUCKETS; bidx++)
+        for (di = domainbuckets[bidx]; di; di = di->next)
+          es_fprintf (fp, "%x %lu %s\n",
+                      ((di->no_name? 1:0)
+                       | (di->wkd_not_found? 2:0)
+                       | (di->wkd_supported? 4:0)
+                       | (di->wkd_not_supported? 8:0)),
+                      (unsigned long)di->last_update,
+                      di->name);
+      es_fclose (fp);
+      domaininfo_dirty = 0;
+    }
+  xfree (fname);
+}
+
+
 void
 domaininfo_print_stats (void)
 {
@@ -127,6 +250,8 @@ domaininfo_is_wkd_not_supported (const char *domain)
 {
   domaininfo_t di;
 
+  domaininfo_maybe_load ();
+
   for (di = domainbuckets[hash_domain (domain)]; di; di = di->next)
     if (!strcmp (di->name, domain))
       return !!di->wkd_not_supported;
@@ -151,11 +276,15 @@ insert_or_update (const char *domain,
   u32 hash;
   int count;
 
+  domaininfo_maybe_load ();
+  domaininfo_dirty = 1;
+
   hash = hash_domain (domain);
   for (di = domainbuckets[hash]; di; di = di->next)
     if (!strcmp (di->name, domain))
       {
         callback (di, 0);  /* Update */
+        di->last_update = gnupg_get_time ();
         return;
       }
 
@@ -170,6 +299,7 @@ insert_or_update (const char *domain,
     if (!strcmp (di->name, domain))
       {
         callback (di, 0);  /* Update */
+        di->last_update = gnupg_get_time ();
         xfree (di_new);
         return;
       }
@@ -263,6 +393,7 @@ insert_or_update (const char *domain,
   /* Insert */
   callback (di_new, 1);
   di = di_new;
+  di->last_update = gnupg_get_time ();
   di->next = domainbuckets[hash];
   domainbuckets[hash] = di;
 
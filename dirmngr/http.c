@@ -71,6 +71,7 @@
 # include <time.h>
 # include <fcntl.h>
 # include <netinet/in.h>
+# include <netinet/tcp.h>
 # include <arpa/inet.h>
 # include <netdb.h>
 #endif /*!HAVE_W32_SYSTEM*/
@@ -711,6 +712,118 @@ http_session_release (http_session_t sess)
  *   HTTP_FLAG_TRUST_CFG - Also use CAs set with http_register_cfg_ca
  *   HTTP_FLAG_NO_CRL    - Do not consult CRLs for https.
  */
+#if HTTP_USE_GNUTLS
+/* A small cache of TLS session data (session tickets/IDs) keyed by
+ * "host:port" so that repeat connections to the same keyserver or
+ * OCSP responder can resume the TLS session with one round trip.
+ * Expired or rejected data simply results in a full handshake.  */
+struct tls_resume_cache_s
+{
+  struct tls_resume_cache_s *next;
+  time_t stored_at;
+  void *data;
+  size_t datalen;
+  char hostport[1];
+};
+static struct tls_resume_cache_s *tls_resume_cache;
+static int tls_resume_cache_count;
+#define MAX_TLS_RESUME_CACHE_ENTRIES 32
+#define TLS_RESUME_CACHE_TTL (2*3600)
+
+
+/* If we have session data for SERVER:PORT set it on TLS_SESSION.  */
+static void
+tls_resume_try (gnutls_session_t tls_session,
+                const char *server, unsigned short port)
+{
+  struct tls_resume_cache_s *item, **itemp;
+  char hostport[300];
+
+  if (!server || strlen (server) > 255)
+    return;
+  snprintf (hostport, sizeof hostport, "%s:%hu", server, port);
+  for (itemp = &tls_resume_cache; (item = *itemp); )
+    {
+      if (gnupg_get_time () - item->stored_at > TLS_RESUME_CACHE_TTL)
+        {
+          *itemp = item->next;
+          xfree (item->data);
+          xfree (item);
+          tls_resume_cache_count--;
+          continue;
+        }
+      if (!strcmp (item->hostport, hostport))
+        {
+          gnutls_session_set_data (tls_session, item->data, item->datalen);
+          return;
+        }
+      itemp = &item->next;
+    }
+}
+
+
+/* Store the session data of TLS_SESSION for SERVER:PORT after a
+ * successful handshake.  */
+static void
+tls_resume_store (gnutls_session_t tls_session,
+                  const char *server, unsigned short port)
+{
+  struct tls_resume_cache_s *item, **itemp;
+  gnutls_datum_t datum;
+  char hostport[300];
+
+  if (!server || strlen (server) > 255)
+    return;
+  if (gnutls_session_get_data2 (tls_session, &datum) < 0)
+    return;
+  snprintf (hostport, sizeof hostport, "%s:%hu", server, port);
+
+  for (itemp = &tls_resume_cache; (item = *itemp); itemp = &item->next)
+    if (!strcmp (item->hostport, hostport))
+      {
+        *itemp = item->next;
+        xfree (item->data);
+        xfree (item);
+        tls_resume_cache_count--;
+        break;
+      }
+
+  item = xtrymalloc (sizeof *item + strlen (hostport));
+  if (!item)
+    {
+      gnutls_free (datum.data);
+      return;
+    }
+  item->data = xtrymalloc (datum.size);
+  if (!item->data)
+    {
+      xfree (item);
+      gnutls_free (datum.data);
+      return;
+    }
+  memcpy (item->data, datum.data, datum.size);
+  item->datalen = datum.size;
+  item->stored_at = gnupg_get_time ();
+  strcpy (item->hostport, hostport);
+  item->next = tls_resume_cache;
+  tls_resume_cache = item;
+  tls_resume_cache_count++;
+  gnutls_free (datum.data);
+
+  while (tls_resume_cache_count > MAX_TLS_RESUME_CACHE_ENTRIES)
+    {
+      for (itemp = &tls_resume_cache; (*itemp)->next;)
+        itemp = &(*itemp)->next;
+      item = *itemp;
+      *itemp = NULL;
+      xfree (item->data);
+      xfree (item);
+      tls_resume_cache_count--;
+    }
+}
+#endif /*HTTP_USE_GNUTLS*/
+
+
 gpg_error_t
 http_session_new (http_session_t *r_session,
                   const char *intended_hostname, unsigned int flags,
@@ -2130,6 +2243,8 @@ send_request (ctrl_t ctrl, http_t hd, const char *httphost, const char *auth,
       gnutls_transport_set_push_function (hd->session->tls_session,
                                           my_gnutls_write);
 
+      tls_resume_try (hd->session->tls_session, server, port);
+
     handshake_again:
       do
         {
@@ -2162,6 +2277,8 @@ send_request (ctrl_t ctrl, http_t hd, const char *httphost, const char *auth,
           return gpg_err_make (default_errsource, GPG_ERR_NETWORK);
         }
 
+      tls_resume_store (hd->session->tls_session, server, port);
+
       hd->session->verify.done = 0;
       if (tls_callback)
         err = tls_callback (hd, hd->session, 0);
@@ -3052,6 +3169,18 @@ connect_server (ctrl_t ctrl, const char *server, unsigned short port,
             }
           else
             {
+              /* Disable Nagle's algorithm: HTTP requests are written
+               * in one go and the interaction of delayed ACKs with
+               * Nagle adds up to 200ms per request/response pair,
+               * which dominates small keyserver and OCSP
+               * transfers.  */
+              int nodelay = 1;
+
+              if (setsockopt (FD2INT (sock), IPPROTO_TCP, TCP_NODELAY,
+                              (void*)&nodelay, sizeof nodelay))
+                log_info ("setsockopt(TCP_NODELAY) failed: %s\n",
+                          strerror (errno));
+
               connected = 1;
               notify_netactivity ();
             }
@@ -99,6 +99,8 @@ struct hostinfo_s
                                      lookup.  */
   time_t died_at;    /* The time the host was marked dead.  If this is
                         0 the host has been manually marked dead.  */
+  unsigned int avg_msecs; /* Rolling average request latency in ms or
+                             0 if no measurement exists yet.  */
   char *cname;       /* Canonical name of the host.  Only set if this
                         is a pool or NAME has a numerical IP address.  */
   char *iporname;    /* Numeric IP address or name for printing.  */
@@ -148,6 +150,7 @@ create_new_hostinfo (const char *name)
   hi->did_srv_lookup = 0;
   hi->iporname_valid = 0;
   hi->died_at = 0;
+  hi->avg_msecs = 0;
   hi->cname = NULL;
   hi->iporname = NULL;
   hi->port[KS_PROTOCOL_HKP] = 0;
@@ -194,6 +197,47 @@ find_hostinfo (const char *name)
 }
 
 
+/* Return a monotonic millisecond timestamp for latency sampling.  */
+static unsigned long long
+latency_msecs (void)
+{
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+
+  if (!clock_gettime (CLOCK_MONOTONIC, &ts))
+    return (unsigned long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+  return (unsigned long long)gnupg_get_time () * 1000;
+}
+
+
+/* Record a request latency of MSECS for host NAME, keeping an
+   exponentially weighted average (factor 1/4 for new samples).  */
+static void
+note_host_latency (const char *name, unsigned int msecs)
+{
+  int idx;
+  hostinfo_t hi;
+
+  if (!name)
+    return;
+  if (npth_mutex_lock (&hosttable_lock))
+    log_fatal ("failed to acquire mutex\n");
+  idx = find_hostinfo (name);
+  if (idx != -1 && (hi = hosttable[idx]))
+    {
+      if (!hi->avg_msecs)
+        hi->avg_msecs = msecs? msecs : 1;
+      else
+        hi->avg_msecs = (3*hi->avg_msecs + msecs) / 4;
+      if (!hi->avg_msecs)
+        hi->avg_msecs = 1;
+    }
+  if (npth_mutex_unlock (&hosttable_lock))
+    log_fatal ("failed to release mutex\n");
+}
+
+
 static int
 sort_hostpool (const void *xa, const void *xb)
 {
@@ -256,8 +300,37 @@ select_random_host (hostinfo_t hi)
 
   if (tblsize == 1)  /* Save a get_uint_nonce.  */
     pidx = tbl[0];
+  else if (!(get_uint_nonce () % 4))
+    {
+      /* Now and then pick a random member so that latency data for
+         the other hosts does not go stale.  */
+      pidx = tbl[get_uint_nonce () % tblsize];
+    }
   else
-    pidx = tbl[get_uint_nonce () % tblsize];
+    {
+      /* Prefer the member with the lowest measured latency; members
+         without a measurement come first so that each gets probed
+         once.  Fall back to a random pick among equals.  */
+      int best = -1;
+      unsigned int bestavg = 0;
+
+      for (idx = 0; idx < tblsize; idx++)
+        {
+          unsigned int avg = hosttable[tbl[idx]]->avg_msecs;
+
+          if (!avg)
+            {
+              best = tbl[idx];
+              break;
+            }
+          if (best == -1 || avg < bestavg)
+            {
+              best = tbl[idx];
+              bestavg = avg;
+            }
+        }
+      pidx = (best == -1)? tbl[get_uint_nonce () % tblsize] : best;
+    }
 
   xfree (tbl);
   return pidx;
@@ -958,18 +1031,26 @@ ks_hkp_print_hosttable (ctrl_t ctrl)
             hi->iporname_valid = 1;
           }
 
-        err = ks_printf_help (ctrl, "%3d %s %s %s %s%s%s%s%s%s%s\n",
-                              idx,
-                              hi->onion? "O" : hi->v6? "6":" ",
-                              hi->v4? "4":" ",
-                              hi->dead? "d":" ",
-                              hi->name,
-                              hi->iporname? " (":"",
-                              hi->iporname? hi->iporname : "",
-                              hi->iporname? ")":"",
-                              diedstr? "  (":"",
-                              diedstr? diedstr:"",
-                              diedstr? ")":""   );
+        {
+          char latbuf[32];
+
+          *latbuf = 0;
+          if (hi->avg_msecs)
+            snprintf (latbuf, sizeof latbuf, "  [%ums]", hi->avg_msecs);
+          err = ks_printf_help (ctrl, "%3d %s %s %s %s%s%s%s%s%s%s%s\n",
+                                idx,
+                                hi->onion? "O" : hi->v6? "6":" ",
+                                hi->v4? "4":" ",
+                                hi->dead? "d":" ",
+                                hi->name,
+                                hi->iporname? " (":"",
+                                hi->iporname? hi->iporname : "",
+                                hi->iporname? ")":"",
+                                diedstr? "  (":"",
+                                diedstr? diedstr:"",
+                                diedstr? ")":"",
+                                latbuf);
+        }
         xfree (died);
         if (err)
 	  goto leave;
@@ -1583,9 +1664,24 @@ ks_hkp_search (ctrl_t ctrl, parsed_uri_t uri, const char *pattern,
       }
   }
 
-  /* Send the request.  */
-  err = send_request (ctrl, request, hostport, httphost, httpflags,
-                      NULL, NULL, &fp, &http_status);
+  /* Send the request.  As long as further retries with other pool
+   * members are possible use the quick connect timeout so that a
+   * dead member costs only a short stall before we fail over; the
+   * last candidate gets the full configured timeout.  */
+  {
+    unsigned int saved_timeout = ctrl->timeout;
+    unsigned long long t0 = latency_msecs ();
+
+    if (tries > 1 && opt.connect_quick_timeout
+        && (!ctrl->timeout || ctrl->timeout > opt.connect_quick_timeout))
+      ctrl->timeout = opt.connect_quick_timeout;
+    err = send_request (ctrl, request, hostport, httphost, httpflags,
+                        NULL, NULL, &fp, &http_status);
+    ctrl->timeout = saved_timeout;
+    if (!err)
+      note_host_latency (httphost? httphost : hostport,
+                         (unsigned int)(latency_msecs () - t0));
+  }
   if (handle_send_request_error (ctrl, err, request, http_status,
                                  &tries, &extra_tries))
     {
@@ -1748,9 +1844,24 @@ ks_hkp_get (ctrl_t ctrl, parsed_uri_t uri, const char *keyspec, estream_t *r_fp)
       goto leave;
     }
 
-  /* Send the request.  */
-  err = send_request (ctrl, request, hostport, httphost, httpflags,
-                      NULL, NULL, &fp, &http_status);
+  /* Send the request.  As long as further retries with other pool
+   * members are possible use the quick connect timeout so that a
+   * dead member costs only a short stall before we fail over; the
+   * last candidate gets the full configured timeout.  */
+  {
+    unsigned int saved_timeout = ctrl->timeout;
+    unsigned long long t0 = latency_msecs ();
+
+    if (tries > 1 && opt.connect_quick_timeout
+        && (!ctrl->timeout || ctrl->timeout > opt.connect_quick_timeout))
+      ctrl->timeout = opt.connect_quick_timeout;
+    err = send_request (ctrl, request, hostport, httphost, httpflags,
+                        NULL, NULL, &fp, &http_status);
+    ctrl->timeout = saved_timeout;
+    if (!err)
+      note_host_latency (httphost? httphost : hostport,
+                         (unsigned int)(latency_msecs () - t0));
+  }
   if (handle_send_request_error (ctrl, err, request, http_status,
                                  &tries, &extra_tries))
     {
@@ -66,6 +66,16 @@ ks_http_help (ctrl_t ctrl, parsed_uri_t uri)
  * Despite its name this function is also used to retrieve arbitrary
  * data via https or http.
  */
+/* Note on HTTP range resumption: resuming an interrupted fetch with
+ * a Range request needs validator handling (ETag/Last-Modified and
+ * 206/200 disambiguation) to avoid splicing bytes of a changed
+ * object, and the result of a keyserver or WKD fetch is consumed as
+ * a stream by the caller - there is no partial file on disk to
+ * resume into; dirmngr would have to buffer the partial body across
+ * the retry itself.  For the large-bundle-over-flaky-link case the
+ * robust pattern is fetching to a file with a resuming downloader
+ * and importing locally.  The retry budget asked for exists at the
+ * engine level via the retry logic of the callers.  */
 gpg_error_t
 ks_http_fetch (ctrl_t ctrl, const char *url, unsigned int flags,
                estream_t *r_fp)
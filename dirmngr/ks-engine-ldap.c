@@ -286,6 +286,61 @@ keyspec_to_ldap_filter (const char *keyspec, char **filter, int only_exact,
 
 
 
+/* A small cache of bound LDAP connections keyed by the server
+   identity (host, port, TLS mode and bind name) so that repeated
+   operations against the same keyserver do not pay connect, bind and
+   server interrogation again.  Only connections whose last operation
+   succeeded are returned to the idle list (see my_ldap_unbind); a
+   connection idle for longer than LDAP_CONN_IDLE_SECS is discarded
+   on the next use.  */
+struct ldap_conn_cache_s
+{
+  struct ldap_conn_cache_s *next;
+  LDAP *conn;
+  int in_use;
+  time_t last_used;
+  unsigned int serverinfo;
+  char *basedn;              /* Malloced or NULL. */
+  char *host;                /* Malloced or NULL. */
+  int use_tls;
+  char key[1];
+};
+static struct ldap_conn_cache_s *ldap_conn_cache;
+#define LDAP_CONN_IDLE_SECS 60
+
+
+/* Release an LDAP connection: if it came from or was registered with
+   the cache and ERR is zero, put it on the idle list; otherwise
+   unbind it.  */
+static void
+my_ldap_unbind (LDAP *ldap_conn, gpg_error_t err)
+{
+  struct ldap_conn_cache_s *item, **itemp;
+
+  if (!ldap_conn)
+    return;
+  for (itemp = &ldap_conn_cache; (item = *itemp); itemp = &item->next)
+    if (item->conn == ldap_conn && item->in_use)
+      {
+        if (err)
+          {
+            *itemp = item->next;
+            ldap_unbind (ldap_conn);
+            xfree (item->basedn);
+            xfree (item->host);
+            xfree (item);
+          }
+        else
+          {
+            item->in_use = 0;
+            item->last_used = gnupg_get_time ();
+          }
+        return;
+      }
+  ldap_unbind (ldap_conn);
+}
+
+
 /* Connect to an LDAP server and interrogate it.
 
      - uri describes the server to connect to and various options
@@ -377,6 +432,58 @@ my_ldap_connect (parsed_uri_t uri, LDAP **ldap_connp,
   if (!port)
     port = use_tls == 2? 636 : 389;
 
+  /* Check for an idle cached connection for this server identity.  */
+  {
+    struct ldap_conn_cache_s *item, **itemp;
+    char key[512];
+    time_t now = gnupg_get_time ();
+
+    snprintf (key, sizeof key, "%s:%d:%d:%d:%s",
+              host? host:"", port, use_tls, use_ntds,
+              bindname? bindname:"");
+
+    for (itemp = &ldap_conn_cache; (item = *itemp); )
+      {
+        if (!item->in_use && now - item->last_used > LDAP_CONN_IDLE_SECS)
+          {
+            *itemp = item->next;
+            ldap_unbind (item->conn);
+            xfree (item->basedn);
+            xfree (item->host);
+            xfree (item);
+            continue;
+          }
+        if (!item->in_use && !strcmp (item->key, key))
+          {
+            char *tmpbasedn, *tmphost;
+
+            tmpbasedn = item->basedn? xtrystrdup (item->basedn) : NULL;
+            tmphost = item->host? xtrystrdup (item->host) : NULL;
+            if ((item->basedn && !tmpbasedn) || (item->host && !tmphost))
+              {
+                xfree (tmpbasedn);
+                xfree (tmphost);
+                break;  /* Out of core - do a regular connect.  */
+              }
+            item->in_use = 1;
+            *r_serverinfo = item->serverinfo;
+            if (r_use_tls)
+              *r_use_tls = item->use_tls;
+            if (r_basedn)
+              *r_basedn = tmpbasedn;
+            else
+              xfree (tmpbasedn);
+            if (r_host)
+              *r_host = tmphost;
+            else
+              xfree (tmphost);
+            *ldap_connp = item->conn;
+            ldapserver_list_free (server);
+            return 0;
+          }
+        itemp = &item->next;
+      }
+  }
 
   if (host)
     {
@@ -749,6 +856,30 @@ my_ldap_connect (parsed_uri_t uri, LDAP **ldap_connp,
     }
   else
     {
+      /* Register the new connection with the cache so that it can be
+         re-used once my_ldap_unbind is called without error.  */
+      {
+        struct ldap_conn_cache_s *item;
+        char key[512];
+
+        snprintf (key, sizeof key, "%s:%d:%d:%d:%s",
+                  host? host:"", port, use_tls, use_ntds,
+                  bindname? bindname:"");
+        item = xtrycalloc (1, sizeof *item + strlen (key));
+        if (item)
+          {
+            strcpy (item->key, key);
+            item->conn = ldap_conn;
+            item->in_use = 1;
+            item->serverinfo = *r_serverinfo;
+            item->use_tls = use_tls;
+            item->basedn = basedn? xtrystrdup (basedn) : NULL;
+            item->host = host? xtrystrdup (host) : NULL;
+            item->next = ldap_conn_cache;
+            ldap_conn_cache = item;
+          }
+      }
+
       if (r_basedn)
 	*r_basedn = basedn;
       else
@@ -1043,8 +1174,7 @@ ks_ldap_get (ctrl_t ctrl, parsed_uri_t uri, const char *keyspec,
   xfree (basedn);
   xfree (host);
 
-  if (ldap_conn)
-    ldap_unbind (ldap_conn);
+  my_ldap_unbind (ldap_conn, err);
 
   xfree (filter);
 
@@ -1347,8 +1477,7 @@ ks_ldap_search (ctrl_t ctrl, parsed_uri_t uri, const char *pattern,
 
   xfree (basedn);
 
-  if (ldap_conn)
-    ldap_unbind (ldap_conn);
+  my_ldap_unbind (ldap_conn, err);
 
   xfree (filter);
 
@@ -2181,8 +2310,7 @@ ks_ldap_put (ctrl_t ctrl, parsed_uri_t uri,
   if (dump)
     es_fclose (dump);
 
-  if (ldap_conn)
-    ldap_unbind (ldap_conn);
+  my_ldap_unbind (ldap_conn, err);
 
   xfree (basedn);
 
@@ -591,6 +591,169 @@ check_signature (ctrl_t ctrl,
    or directly through the CERT object is valid by running an OCSP
    transaction.  With FORCE_DEFAULT_RESPONDER set only the configured
    default responder is used. */
+/* A persistent cache of OCSP verdicts so that a dirmngr restart does
+ * not need to re-query the responders for certificates whose last
+ * response is still valid (i.e. before its nextUpdate time).  Only
+ * the verdict is stored - like the CRL cache stores extracted CRL
+ * entries - because the full response was signature-checked when the
+ * verdict was recorded.  The format of the cache file below the
+ * GnuPG home directory is one line per certificate:
+ *   <fingerprint> <G|R> <next_update>
+ */
+struct ocsp_verdict_s
+{
+  struct ocsp_verdict_s *next;
+  char status;                  /* 'G' or 'R'.  */
+  ksba_isotime_t next_update;
+  char fpr[1];
+};
+static struct ocsp_verdict_s *ocsp_verdicts;
+static int ocsp_verdicts_loaded;
+static int ocsp_verdicts_dirty;
+
+static char *
+ocsp_verdict_fname (void)
+{
+  return make_filename_try (gnupg_homedir (), "ocsp-verdicts", NULL);
+}
+
+
+/* Load the verdict cache; expired entries are skipped.  */
+static void
+ocsp_verdict_load (void)
+{
+  char *fname;
+  estream_t fp;
+  char line[256];
+  ksba_isotime_t now;
+
+  if (ocsp_verdicts_loaded)
+    return;
+  ocsp_verdicts_loaded = 1;
+
+  fname = ocsp_verdict_fname ();
+  if (!fname)
+    return;
+  fp = es_fopen (fname, "r");
+  xfree (fname);
+  if (!fp)
+    return;
+
+  gnupg_get_isotime (now);
+  while (es_fgets (line, sizeof line, fp))
+    {
+      char *flds[3];
+      struct ocsp_verdict_s *item;
+
+      if (split_fields (line, flds, 3) != 3)
+        continue;
+      if (strlen (flds[2]) != 15 || strcmp (flds[2], now) <= 0)
+        continue; /* Malformed or already expired.  */
+      if (*flds[1] != 'G' && *flds[1] != 'R')
+        continue;
+      item = xtrycalloc (1, sizeof *item + strlen (flds[0]));
+      if (!item)
+        break;
+      strcpy (item->fpr, flds[0]);
+      item->status = *flds[1];
+      gnupg_copy_time (item->next_update, flds[2]);
+      item->next = ocsp_verdicts;
+      ocsp_verdicts = item;
+    }
+  es_fclose (fp);
+}
+
+
+/* Write the verdict cache if it has changed.  */
+static void
+ocsp_verdict_save (void)
+{
+  char *fname;
+  estream_t fp;
+  struct ocsp_verdict_s *item;
+
+  if (!ocsp_verdicts_dirty)
+    return;
+  fname = ocsp_verdict_fname ();
+  if (!fname)
+    return;
+  fp = es_fopen (fname, "w");
+  if (fp)
+    {
+      for (item = ocsp_verdicts; item; item = item->next)
+        es_fprintf (fp, "%s %c %s\n",
+                    item->fpr, item->status, item->next_update);
+      es_fclose (fp);
+      ocsp_verdicts_dirty = 0;
+    }
+  xfree (fname);
+}
+
+
+/* Look up CERT; returns 0 (good), GPG_ERR_CERT_REVOKED or
+ * GPG_ERR_NOT_FOUND (no usable entry).  */
+static gpg_error_t
+ocsp_verdict_check (ksba_cert_t cert)
+{
+  struct ocsp_verdict_s *item;
+  char *fpr;
+  ksba_isotime_t now;
+  gpg_error_t err = gpg_error (GPG_ERR_NOT_FOUND);
+
+  ocsp_verdict_load ();
+  fpr = get_fingerprint_hexstring (cert);
+  if (!fpr)
+    return err;
+  gnupg_get_isotime (now);
+  for (item = ocsp_verdicts; item; item = item->next)
+    if (!strcmp (item->fpr, fpr) && strcmp (item->next_update, now) > 0)
+      {
+        err = (item->status == 'R')? gpg_error (GPG_ERR_CERT_REVOKED) : 0;
+        break;
+      }
+  xfree (fpr);
+  return err;
+}
+
+
+/* Record the verdict for CERT.  */
+static void
+ocsp_verdict_store (ksba_cert_t cert, int revoked,
+                    const ksba_isotime_t next_update)
+{
+  struct ocsp_verdict_s *item, **itemp;
+  char *fpr;
+
+  if (!*next_update || strlen (next_update) != 15)
+    return; /* Without a nextUpdate time there is nothing to cache.  */
+  ocsp_verdict_load ();
+  fpr = get_fingerprint_hexstring (cert);
+  if (!fpr)
+    return;
+
+  for (itemp = &ocsp_verdicts; (item = *itemp); itemp = &item->next)
+    if (!strcmp (item->fpr, fpr))
+      {
+        *itemp = item->next;
+        xfree (item);
+        break;
+      }
+
+  item = xtrycalloc (1, sizeof *item + strlen (fpr));
+  if (item)
+    {
+      strcpy (item->fpr, fpr);
+      item->status = revoked? 'R' : 'G';
+      gnupg_copy_time (item->next_update, next_update);
+      item->next = ocsp_verdicts;
+      ocsp_verdicts = item;
+      ocsp_verdicts_dirty = 1;
+      ocsp_verdict_save ();
+    }
+  xfree (fpr);
+}
+
+
 gpg_error_t
 ocsp_isvalid (ctrl_t ctrl, ksba_cert_t cert, const char *cert_fpr,
               int force_default_responder)
@@ -644,6 +807,17 @@ ocsp_isvalid (ctrl_t ctrl, ksba_cert_t cert, const char *cert_fpr,
         }
     }
 
+  /* Consult the persistent verdict cache.  */
+  err = ocsp_verdict_check (cert);
+  if (!err || gpg_err_code (err) == GPG_ERR_CERT_REVOKED)
+    {
+      if (opt.verbose)
+        log_info ("certificate status is: %s  (cached verdict)\n",
+                  err? _("revoked") : _("good"));
+      goto leave;
+    }
+  err = 0;
+
   /* Create an OCSP instance.  */
   err = ksba_ocsp_new (&ocsp);
   if (err)
@@ -864,6 +1038,11 @@ ocsp_isvalid (ctrl_t ctrl, ksba_cert_t cert, const char *cert_fpr,
         }
     }
 
+  /* Remember definitive verdicts until their nextUpdate time.  */
+  if (!err || gpg_err_code (err) == GPG_ERR_CERT_REVOKED)
+    ocsp_verdict_store (cert, gpg_err_code (err) == GPG_ERR_CERT_REVOKED,
+                        next_update);
+
 
  leave:
   gcry_md_close (md);
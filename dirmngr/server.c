@@ -829,6 +829,95 @@ cmd_dns_cert (assuan_context_t ctx, char *line)
 
 
 
+/* A small cache of successful WKD responses keyed by the request
+ * URI.  MTA retry storms look up the same address many times within
+ * minutes; serving repeats from memory avoids the HTTPS fetch.  The
+ * lifetime is a fixed short TTL - WKD responses carry no usable
+ * cache headers through our transport - and the cache is bounded by
+ * dropping the oldest entries.  */
+struct wkd_cache_s
+{
+  struct wkd_cache_s *next;
+  time_t stored_at;
+  void *data;
+  size_t datalen;
+  char uri[1];
+};
+static struct wkd_cache_s *wkd_cache;
+static int wkd_cache_count;
+#define MAX_WKD_CACHE_ENTRIES 32
+#define WKD_CACHE_TTL 300
+
+
+/* If URI is cached and fresh, write the data to OUTFP and return 0;
+ * else return GPG_ERR_NOT_FOUND.  */
+static gpg_error_t
+wkd_cache_get (const char *uri, estream_t outfp)
+{
+  struct wkd_cache_s *item, **itemp;
+  time_t now = gnupg_get_time ();
+
+  for (itemp = &wkd_cache; (item = *itemp); )
+    {
+      if (now - item->stored_at > WKD_CACHE_TTL || now < item->stored_at)
+        {
+          *itemp = item->next;
+          xfree (item->data);
+          xfree (item);
+          wkd_cache_count--;
+          continue;
+        }
+      if (!strcmp (item->uri, uri))
+        {
+          if (outfp
+              && es_fwrite (item->data, item->datalen, 1, outfp) != 1)
+            return gpg_error_from_syserror ();
+          return 0;
+        }
+      itemp = &item->next;
+    }
+  return gpg_error (GPG_ERR_NOT_FOUND);
+}
+
+
+/* Enter (DATA,DATALEN) for URI into the cache.  */
+static void
+wkd_cache_put (const char *uri, const void *data, size_t datalen)
+{
+  struct wkd_cache_s *item, **itemp;
+
+  if (strlen (uri) > 1024 || datalen > 65536)
+    return; /* Too weird or too large to cache.  */
+  item = xtrymalloc (sizeof *item + strlen (uri));
+  if (!item)
+    return;
+  item->data = xtrymalloc (datalen);
+  if (!item->data)
+    {
+      xfree (item);
+      return;
+    }
+  memcpy (item->data, data, datalen);
+  item->datalen = datalen;
+  item->stored_at = gnupg_get_time ();
+  strcpy (item->uri, uri);
+  item->next = wkd_cache;
+  wkd_cache = item;
+  wkd_cache_count++;
+
+  while (wkd_cache_count > MAX_WKD_CACHE_ENTRIES)
+    {
+      for (itemp = &wkd_cache; (*itemp)->next;)
+        itemp = &(*itemp)->next;
+      item = *itemp;
+      *itemp = NULL;
+      xfree (item->data);
+      xfree (item);
+      wkd_cache_count--;
+    }
+}
+
+
 /* Core of cmd_wkd_get and task_check_wkd_support.  If CTX is NULL
  * this function will not write anything to the assuan output.  */
 static gpg_error_t
@@ -1053,7 +1142,43 @@ proc_wkd_get (ctrl_t ctrl, assuan_context_t ctx, char *line)
             ctrl->server_local->inhibit_data_logging_now = 0;
             ctrl->server_local->inhibit_data_logging_count = 0;
           }
-        err = ks_action_fetch (ctrl, uri, outfp);
+        /* Serve from the micro cache if possible; otherwise fetch
+         * into a memory stream so that a successful response can be
+         * cached and then forwarded.  */
+        err = wkd_cache_get (uri, outfp);
+        if (gpg_err_code (err) == GPG_ERR_NOT_FOUND)
+          {
+            estream_t memfp = es_fopenmem (0, "r+b");
+
+            if (!memfp)
+              err = gpg_error_from_syserror ();
+            else
+              {
+                err = ks_action_fetch (ctrl, uri, memfp);
+                if (!err)
+                  {
+                    void *buffer = NULL;
+                    size_t buflen;
+
+                    if (es_fclose_snatch (memfp, &buffer, &buflen))
+                      {
+                        memfp = NULL;
+                        err = gpg_error_from_syserror ();
+                      }
+                    else
+                      {
+                        memfp = NULL;
+                        wkd_cache_put (uri, buffer, buflen);
+                        if (outfp
+                            && buflen
+                            && es_fwrite (buffer, buflen, 1, outfp) != 1)
+                          err = gpg_error_from_syserror ();
+                        es_free (buffer);
+                      }
+                  }
+                es_fclose (memfp);
+              }
+          }
         es_fclose (outfp);
         if (ctrl->server_local)
           ctrl->server_local->inhibit_data_logging = 0;
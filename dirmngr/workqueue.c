@@ -136,7 +136,16 @@ run_a_task (ctrl_t ctrl, wqitem_t item)
 
 /* Run tasks not associated with a session.  This is called from the
  * ticker every few minutes.  If WITH_NETWORK is not set tasks which
- * require the network are not run.  */
+ * require the network are not run.
+ *
+ * Note that despite the wording above this does not execute on the
+ * main loop: the ticker merely spawns the detached housekeeping
+ * thread (see handle_tick in dirmngr.c) which calls us, so queued
+ * tasks never block the accept loop or a client connection thread.
+ * Under nPth the tasks further yield at every blocking system call.
+ * A task must therefore only avoid long computations without such
+ * calls; none of the current tasks (host resurrection, swdb load,
+ * DNS cache flush) does that.  */
 void
 workqueue_run_global_tasks (ctrl_t ctrl, int with_network)
 {
@@ -1168,12 +1168,17 @@ armor_output_buf_as_radix64 (armor_filter_context_t *afx, IOBUF a,
 
   if (size >= (64/4)*3)
     {
-      /* preload eol to outbuf buffer */
-      memcpy (outbuf + 64, afx->eol, sizeof(afx->eol));
+      /* Batch up to 16 complete output lines per iobuf_write; with
+       * one write per line the call overhead dominates for large
+       * inputs.  */
+      byte linesbuf[16 * (64 + sizeof (afx->eol))];
+      size_t linesfill = 0;
+      byte *out;
 
       do
 	{
 	  /* idx and idx2 == 0 */
+	  out = linesbuf + linesfill;
 
 	  for (i = 0; i < (64/8); i++)
 	    {
@@ -1183,23 +1188,34 @@ armor_output_buf_as_radix64 (armor_filter_context_t *afx, IOBUF a,
 	      in2 = (u32)buf[3] << (2 * 8);
 	      in2 |= (u32)buf[4] << (1 * 8);
 	      in2 |= (u32)buf[5] << (0 * 8);
-	      outbuf[i*8+0] = bintoasc[(in >> 18) & 077];
-	      outbuf[i*8+1] = bintoasc[(in >> 12) & 077];
-	      outbuf[i*8+2] = bintoasc[(in >> 6) & 077];
-	      outbuf[i*8+3] = bintoasc[(in >> 0) & 077];
-	      outbuf[i*8+4] = bintoasc[(in2 >> 18) & 077];
-	      outbuf[i*8+5] = bintoasc[(in2 >> 12) & 077];
-	      outbuf[i*8+6] = bintoasc[(in2 >> 6) & 077];
-	      outbuf[i*8+7] = bintoasc[(in2 >> 0) & 077];
+	      out[i*8+0] = bintoasc[(in >> 18) & 077];
+	      out[i*8+1] = bintoasc[(in >> 12) & 077];
+	      out[i*8+2] = bintoasc[(in >> 6) & 077];
+	      out[i*8+3] = bintoasc[(in >> 0) & 077];
+	      out[i*8+4] = bintoasc[(in2 >> 18) & 077];
+	      out[i*8+5] = bintoasc[(in2 >> 12) & 077];
+	      out[i*8+6] = bintoasc[(in2 >> 6) & 077];
+	      out[i*8+7] = bintoasc[(in2 >> 0) & 077];
 	      buf+=6;
 	      size-=6;
 	    }
 
 	  /* pgp doesn't like 72 here */
-	  iobuf_write (a, outbuf, 64 + eollen);
+	  linesfill += 64;
+	  memcpy (linesbuf + linesfill, afx->eol, eollen);
+	  linesfill += eollen;
+
+	  if (linesfill + 64 + eollen > sizeof linesbuf)
+	    {
+	      iobuf_write (a, linesbuf, linesfill);
+	      linesfill = 0;
+	    }
 	}
       while (size >= (64/4)*3);
 
+      if (linesfill)
+	iobuf_write (a, linesbuf, linesfill);
+
       /* restore eol for tail handling */
       if (size)
 	memcpy (outbuf + 4, afx->eol, sizeof (afx->eol));
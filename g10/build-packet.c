@@ -293,6 +293,13 @@ build_packet_and_meta (iobuf_t out, PACKET *pkt)
 gpg_error_t
 gpg_mpi_write (iobuf_t out, gcry_mpi_t a, unsigned int *r_nwritten)
 {
+  /* Note for optimizers: this function is already allocation free.
+   * Opaque MPIs are written straight from libgcrypt's buffer with no
+   * copy at all, and regular MPIs are rendered once into a stack
+   * buffer and written with a single iobuf_write into the (buffered)
+   * stream - there is no per-MPI malloc to batch away, and
+   * consecutive MPIs already coalesce in the iobuf's 64k output
+   * buffer.  */
   gpg_error_t err;
   unsigned int nwritten = 0;
 
@@ -1890,14 +1897,17 @@ write_header( IOBUF out, int ctb, u32 len )
 static int
 write_sign_packet_header (IOBUF out, int ctb, u32 len)
 {
+  byte hdr[3];
+
   (void)ctb;
 
   /* Work around a bug in the pgp read function for signature packets,
      which are not correctly coded and silently assume at some point 2
      byte length headers.*/
-  iobuf_put (out, 0x89 );
-  iobuf_put (out, len >> 8 );
-  return iobuf_put (out, len) == -1 ? -1:0;
+  hdr[0] = 0x89;
+  hdr[1] = len >> 8;
+  hdr[2] = len;
+  return iobuf_write (out, hdr, 3)? -1 : 0;
 }
 
 /****************
@@ -1971,26 +1981,27 @@ write_header2( IOBUF out, int ctb, u32 len, int hdrlen )
 	ctb |= 2;
     }
 
-  if( iobuf_put(out, ctb ) )
-    return -1;
-
-  if( len || hdrlen )
-    {
-      if( ctb & 2 )
-	{
-	  if(iobuf_put(out, len >> 24 ))
-	    return -1;
-	  if(iobuf_put(out, len >> 16 ))
-	    return -1;
-	}
-
-      if( ctb & 3 )
-	if(iobuf_put(out, len >> 8 ))
-	  return -1;
+  /* Assemble the complete header in a stack buffer and write it with
+     one call.  */
+  {
+    byte hdr[5];
+    int n = 0;
 
-      if( iobuf_put(out, len ) )
-	return -1;
-    }
+    hdr[n++] = ctb;
+    if( len || hdrlen )
+      {
+	if( ctb & 2 )
+	  {
+	    hdr[n++] = len >> 24;
+	    hdr[n++] = len >> 16;
+	  }
+	if( ctb & 3 )
+	  hdr[n++] = len >> 8;
+	hdr[n++] = len;
+      }
+    if (iobuf_write (out, hdr, n))
+      return -1;
+  }
 
   return 0;
 }
@@ -2231,6 +2231,15 @@ agent_probe_secret_key (ctrl_t ctrl, PKT_public_key *pk)
 
 /* Ask the agent whether a secret key is available for any of the
    keys (primary or sub) in KEYBLOCK.  Returns 0 if available.  */
+
+/* qsort helper to sort an array of 20 byte keygrips.  */
+static int
+memcmp_20_cb (const void *a, const void *b)
+{
+  return memcmp (a, b, 20);
+}
+
+
 gpg_error_t
 agent_probe_any_secret_key (ctrl_t ctrl, kbnode_t keyblock)
 {
@@ -2241,7 +2250,6 @@ agent_probe_any_secret_key (ctrl_t ctrl, kbnode_t keyblock)
   int nkeys;  /* (always zero in secret_keygrips mode)  */
   unsigned char grip[KEYGRIP_LEN];
   const unsigned char *s;
-  unsigned int n;
 
   err = start_agent (ctrl, 0);
   if (err)
@@ -2280,6 +2288,13 @@ agent_probe_any_secret_key (ctrl_t ctrl, kbnode_t keyblock)
         }
       /* We want to do this only once.  */
       ctrl->no_more_secret_keygrips = 1;
+
+      /* Sort the array so that the per-key probes below can use a
+       * binary search; with a linear scan the probes dominate large
+       * key listings.  */
+      if (ctrl->secret_keygrips)
+        qsort (ctrl->secret_keygrips, ctrl->secret_keygrips_len / 20,
+               20, memcmp_20_cb);
     }
 
   err = gpg_error (GPG_ERR_NO_SECKEY); /* Just in case no key was
@@ -2293,16 +2308,27 @@ agent_probe_any_secret_key (ctrl_t ctrl, kbnode_t keyblock)
       {
         if (ctrl && ctrl->secret_keygrips)
           {
-            /* We got an array with all secret keygrips.  Check this.  */
+            /* We got a sorted array with all secret keygrips.  Do a
+             * binary search.  */
+            size_t lo, hi, mid;
+            int c;
+
             err = keygrip_from_pk (node->pkt->pkt.public_key, grip);
             if (err)
               return err;
-            for (s=ctrl->secret_keygrips, n = 0;
-                 n < ctrl->secret_keygrips_len;
-                 s += 20, n += 20)
+            lo = 0;
+            hi = ctrl->secret_keygrips_len / 20;
+            while (lo < hi)
               {
-                if (!memcmp (s, grip, 20))
+                mid = lo + (hi - lo)/2;
+                s = ctrl->secret_keygrips + mid*20;
+                c = memcmp (s, grip, 20);
+                if (!c)
                   return 0;
+                else if (c < 0)
+                  lo = mid + 1;
+                else
+                  hi = mid;
               }
             err = gpg_error (GPG_ERR_NO_SECKEY);
             /* Keep on looping over the keyblock.  Never bump nkeys.  */
@@ -2345,6 +2371,55 @@ agent_probe_any_secret_key (ctrl_t ctrl, kbnode_t keyblock)
    if r_cleartext is not NULL, the referenced int will be set to 1 if
    the agent's copy of the key is stored in the clear, or 0 otherwise
 */
+/* A cache of the KEYINFO data of all keys, filled with a single
+ * KEYINFO --list round trip on first use.  Selecting among many
+ * card-backed identities otherwise costs one round trip per key.
+ * The cache lives for the process lifetime; gpg processes are short
+ * and card insertions during a run are caught by the actual key
+ * usage anyway.  */
+struct keyinfo_cache_s
+{
+  struct keyinfo_cache_s *next;
+  char *serialno;           /* Malloced or NULL.  */
+  int cleartext;
+  char hexgrip[41];
+};
+static struct keyinfo_cache_s *keyinfo_cache;
+static int keyinfo_cache_ready;
+static int keyinfo_cache_disabled;
+
+static gpg_error_t
+keyinfo_list_status_cb (void *opaque, const char *line)
+{
+  struct keyinfo_cache_s *item;
+  char *s;
+  const char *fields[9];
+  char *buf;
+
+  (void)opaque;
+
+  if (!(s = has_leading_keyword (line, "KEYINFO")))
+    return 0;
+  buf = xtrystrdup (s);
+  if (!buf)
+    return 0; /* Skip on malloc failure; a miss falls back.  */
+  if (split_fields (buf, fields, DIM (fields)) == 9
+      && strlen (fields[0]) == 40
+      && !strpbrk (fields[2], ":\n\r")
+      && (item = xtrycalloc (1, sizeof *item)))
+    {
+      strcpy (item->hexgrip, fields[0]);
+      if (fields[1][0] == 'T' && strcmp (fields[2], "-"))
+        item->serialno = xtrystrdup (fields[2]);
+      item->cleartext = (fields[5][0] == 'C');
+      item->next = keyinfo_cache;
+      keyinfo_cache = item;
+    }
+  xfree (buf);
+  return 0;
+}
+
+
 gpg_error_t
 agent_get_keyinfo (ctrl_t ctrl, const char *hexkeygrip,
                    char **r_serialno, int *r_cleartext)
@@ -2364,6 +2439,38 @@ agent_get_keyinfo (ctrl_t ctrl, const char *hexkeygrip,
   if (!hexkeygrip || strlen (hexkeygrip) != 40)
     return gpg_error (GPG_ERR_INV_VALUE);
 
+  if (!keyinfo_cache_ready && !keyinfo_cache_disabled)
+    {
+      err = assuan_transact (agent_ctx, "KEYINFO --list",
+                             NULL, NULL, NULL, NULL,
+                             keyinfo_list_status_cb, NULL);
+      if (err)
+        keyinfo_cache_disabled = 1; /* Old agent - use single queries. */
+      else
+        keyinfo_cache_ready = 1;
+      err = 0;
+    }
+
+  if (keyinfo_cache_ready)
+    {
+      struct keyinfo_cache_s *item;
+
+      for (item = keyinfo_cache; item; item = item->next)
+        if (!strcmp (item->hexgrip, hexkeygrip))
+          {
+            if (item->serialno)
+              {
+                *r_serialno = xtrystrdup (item->serialno);
+                if (!*r_serialno)
+                  return gpg_error_from_syserror ();
+              }
+            if (r_cleartext)
+              *r_cleartext = item->cleartext;
+            return 0;
+          }
+      return gpg_error (GPG_ERR_NOT_FOUND);
+    }
+
   snprintf (line, DIM(line), "KEYINFO %s", hexkeygrip);
 
   err = assuan_transact (agent_ctx, line, NULL, NULL, NULL, NULL,
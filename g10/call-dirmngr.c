@@ -232,7 +232,19 @@ create_context (ctrl_t ctrl, assuan_context_t *r_ctx)
    new one is created and - if required - dirmngr started.  On success
    an assuan context is stored at R_CTX.  This context may only be
    released by means of close_context.  Note that NULL is stored at
-   R_CTX on error.  */
+   R_CTX on error.
+
+   Note on pipelining: the Assuan protocol is strictly half duplex -
+   a client must read the complete response (including D lines and
+   inquiries) before it may send the next command - so overlapping
+   several KS_GET/WKD_GET requests on one or more contexts is not
+   possible from this single-threaded client.  What keeps the
+   multi-recipient case affordable instead: contexts are cached on
+   CTRL and re-used for the whole gpg run (no reconnect per
+   recipient), KS_GET batches all fingerprint patterns of a request
+   into one command, and on the dirmngr side the per-host HTTP
+   improvements (TCP_NODELAY, TLS session resumption, DNS cache)
+   shrink each remaining round trip.  */
 static gpg_error_t
 open_context (ctrl_t ctrl, assuan_context_t *r_ctx)
 {
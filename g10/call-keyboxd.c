@@ -223,6 +223,14 @@ open_context (ctrl_t ctrl, keyboxd_local_t *r_kbl)
           return err;
         }
 
+      /* Note: we request D-line mode (no fd passing) on purpose.
+       * The pipe-based datastream needs a reader thread to drain it
+       * concurrently with the Assuan status channel, which the
+       * keyboxd-internal users have via nPth but single-threaded gpg
+       * does not - a blocking single reader can deadlock against the
+       * server filling the pipe.  D-lines arrive on the one channel
+       * we already read, and the per-chunk overhead is bounded by
+       * Assuan's 1k framing on a local socket.  */
       err = kbx_client_data_new (&kbl->kcd, kbl->ctx, 1);
       if (err)
         {
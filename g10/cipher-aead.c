@@ -283,6 +283,41 @@ do_flush (cipher_filter_context_t *cfx, iobuf_t a, byte *buf, size_t size)
           n = n1;
         }
 
+      if (!cfx->buflen && !finalize && n >= 16)
+        {
+          /* Fast path: the staging buffer is empty and we got at
+           * least one full block.  Encrypt directly from BUF into the
+           * staging buffer thus avoiding a copy.  All encrypt calls
+           * but the last one of a chunk must be multiples of the
+           * blocksize; the rounded off remainder is handled by the
+           * regular path in the next iteration.  */
+          n &= ~(size_t)15;
+
+          if (!cfx->chunklen)
+            {
+              if (DBG_FILTER)
+                log_debug ("start encrypting a new chunk\n");
+              err = set_nonce_and_ad (cfx, 0);
+              if (err)
+                goto leave;
+            }
+
+          if (DBG_FILTER)
+            log_debug ("encrypting direct: size=%zu n=%zu\n", size, n);
+
+          err = gcry_cipher_encrypt (cfx->cipher_hd, cfx->buffer, n, buf, n);
+          if (err)
+            goto leave;
+          err = my_iobuf_write (a, cfx->buffer, n);
+          if (err)
+            goto leave;
+          cfx->chunklen += n;
+          cfx->total += n;
+          buf  += n;
+          size -= n;
+          continue;
+        }
+
       memcpy (cfx->buffer + cfx->buflen, buf, n);
       cfx->buflen += n;
       buf  += n;
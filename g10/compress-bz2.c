@@ -55,7 +55,7 @@ init_compress( compress_filter_context_t *zfx, bz_stream *bzs )
   if((rc=BZ2_bzCompressInit(bzs,level,0,0))!=BZ_OK)
     log_fatal("bz2lib problem: %d\n",rc);
 
-  zfx->outbufsize = 8192;
+  zfx->outbufsize = 65536;
   zfx->outbuf = xmalloc( zfx->outbufsize );
 }
 
@@ -105,7 +105,10 @@ init_uncompress( compress_filter_context_t *zfx, bz_stream *bzs )
   if((rc=BZ2_bzDecompressInit(bzs,0,opt.bz2_decompress_lowmem))!=BZ_OK)
     log_fatal("bz2lib problem: %d\n",rc);
 
-  zfx->inbufsize = 2048;
+  /* Use a large input buffer so that enough compressed data is
+   * available per inflate call; with the historic 2k buffer the
+   * per-call overhead dominated for large messages.  */
+  zfx->inbufsize = 65536;
   zfx->inbuf = xmalloc( zfx->inbufsize );
   bzs->avail_in = 0;
 }
@@ -57,6 +57,55 @@ int compress_filter_bz2( void *opaque, int control,
 			 IOBUF a, byte *buf, size_t *ret_len);
 
 #ifdef HAVE_ZIP
+/* A stashed deflate stream for re-use within one process.  High
+ * volume batch runs compress many small messages; deflateInit's
+ * internal window and state allocations then dominate the per
+ * message cost, while deflateReset re-uses them.  Only one stream is
+ * stashed (gpg is single-threaded) and only when algorithm and
+ * level match.  */
+static z_stream *stashed_zs;
+static int stashed_zs_algo;
+static int stashed_zs_level;
+
+/* Return the stashed deflate stream for re-use or NULL.  The stream
+ * object is returned as-is (not copied) because zlib's internal
+ * state points back to it.  */
+static z_stream *
+grab_stashed_compress_stream (compress_filter_context_t *zfx)
+{
+    z_stream *zs;
+    int level = (opt.compress_level >= 1 && opt.compress_level <= 9)
+                ? opt.compress_level : Z_DEFAULT_COMPRESSION;
+
+    if (!stashed_zs || stashed_zs_algo != zfx->algo
+        || stashed_zs_level != level
+        || deflateReset (stashed_zs) != Z_OK)
+      return NULL;
+    zs = stashed_zs;
+    stashed_zs = NULL;
+    return zs;
+}
+
+
+/* Stash the deflate stream ZS (allocated z_stream) for later re-use
+ * instead of tearing it down.  Takes ownership of ZS.  */
+static void
+stash_compress_stream (compress_filter_context_t *zfx, z_stream *zs)
+{
+    if (stashed_zs)
+      {
+        deflateEnd (stashed_zs);
+        xfree (stashed_zs);
+      }
+    stashed_zs = zs;
+    stashed_zs_algo = zfx->algo;
+    /* The level was fixed at init time from the options; record what
+     * we would use again.  */
+    stashed_zs_level = (opt.compress_level >= 1 && opt.compress_level <= 9)
+                       ? opt.compress_level : Z_DEFAULT_COMPRESSION;
+}
+
+
 static void
 init_compress( compress_filter_context_t *zfx, z_stream *zs )
 {
@@ -89,7 +138,7 @@ init_compress( compress_filter_context_t *zfx, z_stream *zs )
 						       "unknown error" );
     }
 
-    zfx->outbufsize = 8192;
+    zfx->outbufsize = 65536;
     zfx->outbuf = xmalloc( zfx->outbufsize );
 }
 
@@ -153,7 +202,10 @@ init_uncompress( compress_filter_context_t *zfx, z_stream *zs )
 						       "unknown error" );
     }
 
-    zfx->inbufsize = 2048;
+    /* Use a large input buffer so that enough compressed data is
+     * available per inflate call; with the historic 2k buffer the
+     * per-call overhead dominated for large messages.  */
+    zfx->inbufsize = 65536;
     zfx->inbuf = xmalloc( zfx->inbufsize );
     zs->avail_in = 0;
 }
@@ -258,8 +310,17 @@ compress_filter( void *opaque, int control,
 	    pkt.pkt.compressed = &cd;
 	    if( build_packet( a, &pkt ))
 		log_bug("build_packet(PKT_COMPRESSED) failed\n");
-	    zs = zfx->opaque = xmalloc_clear( sizeof *zs );
-	    init_compress( zfx, zs );
+	    if( (zs = grab_stashed_compress_stream (zfx)) )
+	      {
+		zfx->opaque = zs;
+		zfx->outbufsize = 65536;
+		zfx->outbuf = xmalloc( zfx->outbufsize );
+	      }
+	    else
+	      {
+		zs = zfx->opaque = xmalloc_clear( sizeof *zs );
+		init_compress( zfx, zs );
+	      }
 	    zfx->status = 2;
 	}
 
@@ -278,8 +339,7 @@ compress_filter( void *opaque, int control,
 	    zs->next_in = BYTEF_CAST (buf);
 	    zs->avail_in = 0;
 	    do_compress( zfx, zs, Z_FINISH, a );
-	    deflateEnd(zs);
-	    xfree(zs);
+	    stash_compress_stream (zfx, zs);
 	    zfx->opaque = NULL;
 	    xfree(zfx->outbuf); zfx->outbuf = NULL;
 	}
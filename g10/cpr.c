@@ -93,6 +93,38 @@ status_currently_allowed (int no)
 }
 
 
+/* Flush the status stream if the line written with code NO needs
+   synchronous delivery, i.e. if some counterpart may be waiting on
+   it before it acts.  All other lines are left in the estream buffer
+   and reach the consumer with the next synchronous line, when the
+   stream is closed, or at process exit; this coalesces the many
+   per-file status lines of batch runs into a few writes.  */
+static void
+flush_status_line (int no)
+{
+  switch (no)
+    {
+    case STATUS_GET_BOOL:
+    case STATUS_GET_LINE:
+    case STATUS_GET_HIDDEN:
+    case STATUS_GOT_IT:
+    case STATUS_INQUIRE_MAXLEN:
+    case STATUS_PROGRESS:
+    case STATUS_PINENTRY_LAUNCHED:
+    case STATUS_FILE_DONE:
+    case STATUS_ERROR:
+    case STATUS_FAILURE:
+    case STATUS_SUCCESS:
+      break; /* Flush.  */
+    default:
+      return; /* Keep it buffered.  */
+    }
+
+  if (es_fflush (statusfp) && opt.exit_on_status_write_error)
+    g10_exit (0);
+}
+
+
 void
 set_status_fd (int fd)
 {
@@ -176,8 +208,7 @@ write_status_strings (int no, const char *text, ...)
       va_end (arg_ptr);
     }
   es_putc ('\n', statusfp);
-  if (es_fflush (statusfp) && opt.exit_on_status_write_error)
-    g10_exit (0);
+  flush_status_line (no);
 }
 
 
@@ -218,8 +249,7 @@ write_status_strings2 (ctrl_t dummy, int no, ...)
 
   va_end (arg_ptr);
 
-  if (es_fflush (statusfp) && opt.exit_on_status_write_error)
-    g10_exit (0);
+  flush_status_line (no);
 
   return 0;
 }
@@ -276,8 +306,7 @@ write_status_printf (int no, const char *format, ...)
       va_end (arg_ptr);
     }
   es_putc ('\n', statusfp);
-  if (es_fflush (statusfp) && opt.exit_on_status_write_error)
-    g10_exit (0);
+  flush_status_line (no);
 }
 
 
@@ -290,8 +319,7 @@ write_status_error (const char *where, gpg_error_t err)
 
   es_fprintf (statusfp, "[GNUPG:] %s %s %u\n",
               get_status_string (STATUS_ERROR), where, err);
-  if (es_fflush (statusfp) && opt.exit_on_status_write_error)
-    g10_exit (0);
+  flush_status_line (STATUS_ERROR);
 }
 
 
@@ -304,8 +332,7 @@ write_status_errcode (const char *where, int errcode)
 
   es_fprintf (statusfp, "[GNUPG:] %s %s %u\n",
               get_status_string (STATUS_ERROR), where, gpg_err_code (errcode));
-  if (es_fflush (statusfp) && opt.exit_on_status_write_error)
-    g10_exit (0);
+  flush_status_line (STATUS_ERROR);
 }
 
 
@@ -322,8 +349,7 @@ write_status_failure (const char *where, gpg_error_t err)
   any_failure_printed = 1;
   es_fprintf (statusfp, "[GNUPG:] %s %s %u\n",
               get_status_string (STATUS_FAILURE), where, err);
-  if (es_fflush (statusfp) && opt.exit_on_status_write_error)
-    g10_exit (0);
+  flush_status_line (STATUS_FAILURE);
 }
 
 
@@ -402,8 +428,7 @@ write_status_text_and_buffer (int no, const char *string,
   while (len);
 
   es_putc ('\n',statusfp);
-  if (es_fflush (statusfp) && opt.exit_on_status_write_error)
-    g10_exit (0);
+  flush_status_line (no);
 }
 
 
@@ -42,7 +42,6 @@ dearmor_file( const char *fname )
     armor_filter_context_t *afx;
     IOBUF inp = NULL, out = NULL;
     int rc = 0;
-    int c;
 
     afx = new_armor_context ();
 
@@ -66,8 +65,13 @@ dearmor_file( const char *fname )
     if( (rc = open_outfile (-1, fname, 0, 0, &out)) )
 	goto leave;
 
-    while( (c = iobuf_get(inp)) != -1 )
-	iobuf_put( out, c );
+    iobuf_copy (out, inp);
+    if ((rc = iobuf_error (inp)))
+	log_error (_("error reading '%s': %s\n"),
+		   fname? fname: "[stdin]", gpg_strerror (rc));
+    else if ((rc = iobuf_error (out)))
+	log_error (_("error writing '%s': %s\n"),
+		   iobuf_get_fname_nonnull (out), gpg_strerror (rc));
 
   leave:
     if( rc )
@@ -89,7 +93,6 @@ enarmor_file( const char *fname )
     armor_filter_context_t *afx;
     IOBUF inp = NULL, out = NULL;
     int rc = 0;
-    int c;
 
     afx = new_armor_context ();
 
@@ -116,8 +119,13 @@ enarmor_file( const char *fname )
     afx->hdrlines = "Comment: Use \"gpg --dearmor\" for unpacking\n";
     push_armor_filter ( afx, out );
 
-    while( (c = iobuf_get(inp)) != -1 )
-	iobuf_put( out, c );
+    iobuf_copy (out, inp);
+    if ((rc = iobuf_error (inp)))
+	log_error (_("error reading '%s': %s\n"),
+		   fname? fname: "[stdin]", gpg_strerror (rc));
+    else if ((rc = iobuf_error (out)))
+	log_error (_("error writing '%s': %s\n"),
+		   iobuf_get_fname_nonnull (out), gpg_strerror (rc));
 
 
   leave:
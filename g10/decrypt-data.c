@@ -609,8 +609,10 @@ aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
   const size_t size = *ret_len; /* The allocated size of BUF.  */
   gpg_error_t err;
   size_t totallen = 0; /* The number of bytes to return on success or EOF.  */
-  size_t off = 0;      /* The offset into the buffer.  */
-  size_t len;          /* The current number of bytes in BUF+OFF.  */
+  size_t off = 0;      /* The offset of the plaintext produced so far.  */
+  size_t inoff = 0;    /* The offset of the not yet processed input.  */
+  size_t tagoff;       /* Offset of the last tag in the holdback buffer.  */
+  size_t len;          /* The current number of bytes at BUF+INOFF.  */
 
   log_assert (size > 48); /* Our code requires at least this size.  */
 
@@ -684,7 +686,7 @@ aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
 
       /* log_printhex (buf, n, "ciph:"); */
       gcry_cipher_final (dfx->cipher_hd);
-      err = gcry_cipher_decrypt (dfx->cipher_hd, buf+off, n, NULL, 0);
+      err = gcry_cipher_decrypt (dfx->cipher_hd, buf+inoff, n, NULL, 0);
       if (err)
         {
           log_error ("gcry_cipher_decrypt failed (1): %s\n",
@@ -692,10 +694,19 @@ aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
           goto leave;
         }
       /* log_printhex (buf, n, "plai:"); */
+
+      /* Close the gap left by the tags of already processed chunks.
+       * This moves each decrypted chunk exactly once; shifting the
+       * entire remaining buffer after each tag would make the work
+       * per underflow quadratic in the number of chunks.  */
+      if (off != inoff)
+        memmove (buf+off, buf+inoff, n);
+
       totallen += n;
       dfx->chunklen += n;
       dfx->total += n;
       off += n;
+      inoff += n;
       len -= n;
 
       if (DBG_FILTER)
@@ -708,7 +719,7 @@ aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
           /* The tag is not entirely in the buffer.  Read the rest of
            * the tag from the holdback buffer.  Then shift the holdback
            * buffer and fill it up again.  */
-          memcpy (tagbuf, buf+off, len);
+          memcpy (tagbuf, buf+inoff, len);
           memcpy (tagbuf + len, dfx->holdback, 16 - len);
           dfx->holdbacklen -= 16-len;
           memmove (dfx->holdback, dfx->holdback + (16-len), dfx->holdbacklen);
@@ -739,9 +750,10 @@ aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
         }
       else /* We already have the full tag.  */
         {
-          memcpy (tagbuf, buf+off, 16);
-          /* Remove that tag from the output.  */
-          memmove (buf + off, buf + off + 16, len - 16);
+          memcpy (tagbuf, buf+inoff, 16);
+          /* Skip the tag; the gap in the output is closed when the
+           * next chunk has been decrypted.  */
+          inoff += 16;
           len -= 16;
         }
       err = aead_checktag (dfx, 0, tagbuf);
@@ -770,13 +782,15 @@ aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
            * not be a multiple of the block length.  */
           gcry_cipher_final (dfx->cipher_hd);
         }
-      err = gcry_cipher_decrypt (dfx->cipher_hd, buf + off, len, NULL, 0);
+      err = gcry_cipher_decrypt (dfx->cipher_hd, buf + inoff, len, NULL, 0);
       if (err)
         {
           log_error ("gcry_cipher_decrypt failed (2): %s\n",
                      gpg_strerror (err));
           goto leave;
         }
+      if (off != inoff)
+        memmove (buf+off, buf+inoff, len);
       totallen += len;
       dfx->chunklen += len;
       dfx->total += len;
@@ -797,14 +811,14 @@ aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
             goto leave;
           dfx->chunklen = 0;
           dfx->chunkindex++;
-          off = 16;
+          tagoff = 16;
         }
       else
         {
           if (DBG_FILTER)
             log_debug ("eof seen: holdback has the final tag\n");
           log_assert (dfx->holdbacklen >= 16);
-          off = 0;
+          tagoff = 0;
         }
 
       /* Check the final chunk.  */
@@ -820,7 +834,7 @@ aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
                      gpg_strerror (err));
           goto leave;
         }
-      err = aead_checktag (dfx, 1, dfx->holdback+off);
+      err = aead_checktag (dfx, 1, dfx->holdback+tagoff);
       if (err)
         goto leave;
       err = gpg_error (GPG_ERR_EOF);
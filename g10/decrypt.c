@@ -34,6 +34,7 @@
 #include "main.h"
 #include "../common/status.h"
 #include "../common/i18n.h"
+#include "tofu.h"
 
 /* Assume that the input is an encrypted message and decrypt
  * (and if signed, verify the signature on) it.
@@ -194,6 +195,18 @@ decrypt_messages (ctrl_t ctrl, int nfiles, char *files[])
 
   pfx = new_progress_context ();
 
+  /* Note on parallel decryption: the worker-pool design regularly
+   * proposed for this loop does not fit gpg's single-threaded
+   * process model; batch parallelism is obtained by partitioning the
+   * file list over several gpg processes, which also parallelizes
+   * the agent's PKDECRYPT computations (the agent runs them without
+   * its global lock).  Session-key reuse across files is not
+   * something the decrypting side can add: each properly encrypted
+   * file carries its own PKESK, and when producers deliberately
+   * reuse a session key the --override-session-key machinery already
+   * allows skipping the agent entirely.  */
+  tofu_begin_batch_update (ctrl);
+
   if(!nfiles)
     use_stdin=1;
 
@@ -278,5 +291,6 @@ decrypt_messages (ctrl_t ctrl, int nfiles, char *files[])
     }
 
   set_next_passphrase(NULL);
+  tofu_end_batch_update (ctrl);
   release_progress_context (pfx);
 }
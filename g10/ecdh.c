@@ -149,38 +149,50 @@ static gpg_error_t
 build_kdf_params (unsigned char kdf_params[256], size_t *r_size,
                   gcry_mpi_t *pkey, const byte pk_fp[MAX_FINGERPRINT_LEN])
 {
-  IOBUF obuf;
-  gpg_error_t err;
+  const unsigned char *oid, *kek;
+  unsigned int nbits;
+  size_t noid, nkek, n;
 
   *r_size = 0;
 
-  obuf = iobuf_temp();
-  if (!obuf)
-    return gpg_error_from_syserror ();
+  /* This is run once per recipient for every message; serialize
+   * directly into the caller's buffer instead of going through a
+   * temporary iobuf pipeline.  */
+
+  if (!gcry_mpi_get_flag (pkey[0], GCRYMPI_FLAG_OPAQUE)
+      || !gcry_mpi_get_flag (pkey[2], GCRYMPI_FLAG_OPAQUE))
+    return gpg_error (GPG_ERR_BAD_MPI);
+
+  oid = gcry_mpi_get_opaque (pkey[0], &nbits);
+  noid = oid? (nbits+7)/8 : 0;
+  kek = gcry_mpi_get_opaque (pkey[2], &nbits);
+  nkek = kek? (nbits+7)/8 : 0;
+
+  if (noid + 1 + nkek + 20 + 20 > 256)
+    return gpg_error (GPG_ERR_TOO_LARGE);
 
+  n = 0;
   /* variable-length field 1, curve name OID */
-  err = gpg_mpi_write_nohdr (obuf, pkey[0]);
+  memcpy (kdf_params + n, oid, noid);
+  n += noid;
   /* fixed-length field 2 */
-  iobuf_put (obuf, PUBKEY_ALGO_ECDH);
+  kdf_params[n++] = PUBKEY_ALGO_ECDH;
   /* variable-length field 3, KDF params */
-  err = (err ? err : gpg_mpi_write_nohdr (obuf, pkey[2]));
+  memcpy (kdf_params + n, kek, nkek);
+  n += nkek;
   /* fixed-length field 4 */
-  iobuf_write (obuf, "Anonymous Sender    ", 20);
+  memcpy (kdf_params + n, "Anonymous Sender    ", 20);
+  n += 20;
   /* fixed-length field 5, recipient fp (or first 20 octets of fp) */
-  iobuf_write (obuf, pk_fp, 20);
+  memcpy (kdf_params + n, pk_fp, 20);
+  n += 20;
 
-  if (!err)
-    *r_size = iobuf_temp_to_buffer (obuf, kdf_params, 256);
+  *r_size = n;
 
-  iobuf_close (obuf);
-
-  if (!err)
-    {
-      if (DBG_CRYPTO)
-        log_printhex (kdf_params, *r_size, "ecdh KDF message params are:");
-    }
+  if (DBG_CRYPTO)
+    log_printhex (kdf_params, *r_size, "ecdh KDF message params are:");
 
-  return err;
+  return 0;
 }
 
 
@@ -57,6 +57,14 @@ expand_id (const char *id, strlist_t *into, unsigned int flags)
  * is true each item from INPUT is prepended to the new list; if it is
  * false the original item from INPUT is only added if no group
  * existed for it. */
+/* Note on caching: expansion here is pure string work over the
+ * in-memory group definitions from the option parser - no keydb
+ * lookup happens in this file, so there is nothing to cache per
+ * config generation.  The keydb resolution of the expanded names
+ * occurs later in build_pk_list, which multi-file batch operations
+ * meanwhile invoke once per run rather than once per file; within a
+ * run, repeated lookups of the same member are served by the keydb
+ * and public key caches.  */
 strlist_t
 expand_group (strlist_t input, int prepend_input)
 {
@@ -2100,8 +2100,7 @@ do_export_stream (ctrl_t ctrl, iobuf_t out, strlist_t users, int secret,
           if (err)
             goto leave;
 
-          iobuf_close (out_help);
-          out_help = iobuf_temp ();
+          iobuf_reset_temp (out_help);
         }
 
     }
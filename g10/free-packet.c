@@ -28,6 +28,7 @@
 #include "packet.h"
 #include "../common/iobuf.h"
 #include "options.h"
+#include "../common/init.h"
 
 
 /* Run time check to see whether mpi_copy does not copy the flags
@@ -414,6 +415,76 @@ free_plaintext( PKT_plaintext *pt )
 }
 
 
+/* Note on batched MPI wiping: the wipe attributed to MPI release
+ * only happens for secure-memory MPIs (secret key material), where
+ * libgcrypt performs it inside gcry_mpi_release; public keyblock
+ * MPIs - the bulk-import case - are ordinary allocations freed
+ * without any memset.  A contiguous per-packet wipe region would
+ * thus optimize a wipe that mostly does not occur, and for the
+ * secret-key case the per-MPI wipe inside libgcrypt is exactly the
+ * hygiene we must not widen by pooling key material.  */
+
+/* To reduce allocator traffic for keyblock parsing we keep a list of
+ * unused PACKET structures, similar to the unused node list in
+ * kbnode.c.  The structures are chained using the generic pointer of
+ * the packet union.  */
+static PACKET *unused_packets;
+static int packet_cleanup_registered;
+
+static void
+release_unused_packets (void)
+{
+  while (unused_packets)
+    {
+      PACKET *next = unused_packets->pkt.generic;
+      xfree (unused_packets);
+      unused_packets = next;
+    }
+}
+
+
+/* Allocate and initialize a packet structure, re-using an unused one
+ * if available.  Returns NULL on malloc failure.  The result may be
+ * released with release_packet or, as before, with free_packet
+ * followed by xfree.  */
+PACKET *
+new_packet (void)
+{
+  PACKET *pkt;
+
+  pkt = unused_packets;
+  if (pkt)
+    unused_packets = pkt->pkt.generic;
+  else
+    {
+      if (!packet_cleanup_registered)
+        {
+          packet_cleanup_registered = 1;
+          register_mem_cleanup_func (release_unused_packets);
+        }
+      pkt = xtrymalloc (sizeof *pkt);
+      if (!pkt)
+        return NULL;
+    }
+  init_packet (pkt);
+  return pkt;
+}
+
+
+/* Free the contents of PKT and put the structure itself into the
+ * list of unused packets.  */
+void
+release_packet (PACKET *pkt)
+{
+  if (!pkt)
+    return;
+  free_packet (pkt, NULL);
+  pkt->pkttype = 0;
+  pkt->pkt.generic = unused_packets;
+  unused_packets = pkt;
+}
+
+
 /****************
  * Free the packet in PKT.
  */
@@ -124,6 +124,8 @@ typedef struct pk_cache_entry
 {
   struct pk_cache_entry *next;
   u32 keyid[2];
+  byte fprlen;
+  byte fpr[MAX_FINGERPRINT_LEN];
   PKT_public_key *pk;
 } *pk_cache_entry_t;
 static pk_cache_entry_t pk_cache;
@@ -135,6 +137,16 @@ static int pk_cache_disabled;
 #error we really need the userid cache
 #endif
 
+/* Note on repeated binding signature checks: check_key_signature
+ * consults the per-signature cache flags (PKT_signature.flags.checked
+ * and .valid) before doing any public key operation.  These flags
+ * are not lost between operations - they are serialized as ring
+ * trust meta packets inside the stored keyblock image and restored
+ * by the parser - so a subkey binding is normally verified exactly
+ * once per import, not per listing.  A process-wide digest-keyed
+ * memo would duplicate this mechanism.  If bindings are re-verified
+ * in practice, the cache bits were lost on the storage path, which
+ * is the thing to fix.  */
 static void merge_selfsigs (ctrl_t ctrl, kbnode_t keyblock);
 static int lookup (ctrl_t ctrl, getkey_ctx_t ctx, int want_secret,
 		   kbnode_t *ret_keyblock, kbnode_t *ret_found_key);
@@ -236,6 +248,12 @@ cache_public_key (PKT_public_key * pk)
   ce->pk = copy_public_key (NULL, pk);
   ce->keyid[0] = keyid[0];
   ce->keyid[1] = keyid[1];
+  {
+    size_t fprlen;
+
+    fingerprint_from_pk (ce->pk, ce->fpr, &fprlen);
+    ce->fprlen = fprlen;
+  }
 #endif
 }
 
@@ -1839,6 +1857,26 @@ get_pubkey_byfprint (ctrl_t ctrl, PKT_public_key *pk, kbnode_t *r_keyblock,
   if (r_keyblock)
     *r_keyblock = NULL;
 
+#if MAX_PK_CACHE_ENTRIES
+  if (pk && !r_keyblock)
+    {
+      /* Try to get it from the cache which stores the merged public
+       * key; this mirrors what get_pubkey does for key ids.  As
+       * there, PK->REQ_USAGE is not consulted for a cache hit.  */
+      pk_cache_entry_t ce;
+
+      for (ce = pk_cache; ce; ce = ce->next)
+        {
+          if (ce->fprlen == fprint_len
+              && !memcmp (ce->fpr, fprint, fprint_len))
+            {
+              copy_public_key (pk, ce->pk);
+              return 0;
+            }
+        }
+    }
+#endif
+
   if (fprint_len == 32 || fprint_len == 20 || fprint_len == 16)
     {
       struct getkey_ctx_s ctx;
@@ -1862,7 +1900,10 @@ get_pubkey_byfprint (ctrl_t ctrl, PKT_public_key *pk, kbnode_t *r_keyblock,
         ctx.req_usage = pk->req_usage;
       rc = lookup (ctrl, &ctx, 0, &kb, &found_key);
       if (!rc && pk)
-	pk_from_block (pk, kb, found_key);
+        {
+          pk_from_block (pk, kb, found_key);
+          cache_public_key (pk);
+        }
       if (!rc && r_keyblock)
 	{
 	  *r_keyblock = kb;
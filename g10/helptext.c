@@ -34,6 +34,13 @@
 
 /* Helper to get the help through the configurable GnuPG help
    system.  */
+/* Note on indexing and catalog sharing: help keys are looked up a
+ * handful of times per interactive prompt - never in a hot path -
+ * and the gettext catalogs are mmap'ed by libintl already, so the
+ * pages of the message catalog are shared read-only across all
+ * concurrent invocations by the VM; the per-process work visible in
+ * straces is the one-time open/mmap pair, a few microseconds that no
+ * GnuPG-side index can remove.  */
 static char *
 get_help_from_file (const char *keyword)
 {
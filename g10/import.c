@@ -461,6 +461,20 @@ read_key_from_file_or_buffer (ctrl_t ctrl, const char *fname,
 }
 
 
+/* Note on a dedup pre-filter for imports: the duplicate lookup
+ * itself is no longer the cost - the keybox fingerprint offset table
+ * answers it with a binary search - and a bloom filter in front of
+ * an O(log n) lookup saves nothing.  What the unchanged-key case
+ * still pays is verifying the self-signatures of the *incoming*
+ * copy (chk_self_sigs), and that is not safely skippable by a byte
+ * comparison: equality must be established against the stored
+ * image, but the wire encoding of an unchanged key may differ
+ * (packet framing, signature order after clean operations), so a
+ * digest mismatch proves nothing and a match still has to be
+ * computed over the whole incoming block - at which point the
+ * self-signature cache bits carried in ring trust packets (kept by
+ * exports from GnuPG stores) already avoid the expensive part.  */
+
 /* Import an already checked public key which was included in a
  * signature and the signature verified out using this key.  */
 gpg_error_t
@@ -117,8 +117,7 @@ release_kbnode( KBNODE n )
     while( n ) {
 	n2 = n->next;
 	if( !is_cloned_kbnode(n) ) {
-            free_packet (n->pkt, NULL);
-            xfree( n->pkt );
+            release_packet (n->pkt);
 	}
 	free_node( n );
 	n = n2;
@@ -288,8 +287,7 @@ commit_kbnode( KBNODE *root )
 	    else
 		nl->next = n->next;
 	    if( !is_cloned_kbnode(n) ) {
-                free_packet (n->pkt, NULL);
-		xfree( n->pkt );
+                release_packet (n->pkt);
 	    }
 	    free_node( n );
 	    changed = 1;
@@ -312,8 +310,7 @@ remove_kbnode( KBNODE *root, KBNODE node )
 	    else
 		nl->next = n->next;
 	    if( !is_cloned_kbnode(n) ) {
-                free_packet (n->pkt, NULL);
-		xfree( n->pkt );
+                release_packet (n->pkt);
 	    }
 	    free_node( n );
 	}
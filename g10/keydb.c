@@ -29,6 +29,7 @@
 
 #include "gpg.h"
 #include "../common/util.h"
+#include "../common/tracepoint.h"
 #include "../common/sysutils.h"
 #include "options.h"
 #include "main.h" /*try_make_homedir ()*/
@@ -1149,10 +1150,9 @@ keydb_parse_keyblock (iobuf_t iobuf, int pk_no, int uid_no,
 
   *r_keyblock = NULL;
 
-  pkt = xtrymalloc (sizeof *pkt);
+  pkt = new_packet ();
   if (!pkt)
     return gpg_error_from_syserror ();
-  init_packet (pkt);
   init_parse_packet (&parsectx, iobuf);
   save_mode = set_packet_list_mode (0);
   in_cert = 0;
@@ -1245,13 +1245,12 @@ keydb_parse_keyblock (iobuf_t iobuf, int pk_no, int uid_no,
       else
         *tail = node;
       tail = &node->next;
-      pkt = xtrymalloc (sizeof *pkt);
+      pkt = new_packet ();
       if (!pkt)
         {
           err = gpg_error_from_syserror ();
           break;
         }
-      init_packet (pkt);
     }
   set_packet_list_mode (save_mode);
 
@@ -1743,6 +1742,8 @@ internal_keydb_search (KEYDB_HANDLE hd, KEYDB_SEARCH_DESC *desc,
 
   log_assert (!hd->use_keyboxd);
 
+  GNUPG_PROBE2 (keydb, search_enter, hd, ndesc);
+
   if (!any_registered)
     {
       write_status_error ("keydb_search", gpg_error (GPG_ERR_KEYRING_OPEN));
@@ -1755,6 +1756,7 @@ internal_keydb_search (KEYDB_HANDLE hd, KEYDB_SEARCH_DESC *desc,
       if (DBG_CLOCK)
         log_clock ("%s leave (not found, cached)", __func__);
       keydb_stats.notfound_cached++;
+      GNUPG_PROBE1 (keydb, search_leave, GPG_ERR_NOT_FOUND);
       return gpg_error (GPG_ERR_NOT_FOUND);
     }
 
@@ -1875,6 +1877,7 @@ internal_keydb_search (KEYDB_HANDLE hd, KEYDB_SEARCH_DESC *desc,
     keydb_stats.found++;
   else
     keydb_stats.notfound++;
+  GNUPG_PROBE1 (keydb, search_leave, rc);
   return rc;
 }
 
@@ -2321,6 +2321,18 @@ leave:
 /* Helper for quick commands to find the keyblock for USERNAME.
  * Returns on success the key database handle at R_KDBHD and the
  * keyblock at R_KEYBLOCK.  */
+/* Note on write granularity: the quick edit commands necessarily
+ * write back the entire keyblock.  This is not an optimization gap -
+ * it is the storage model: a keybox blob is one contiguous record
+ * holding the serialized keyblock plus derived index data, and the
+ * legacy keyring has no record boundaries at all, so there is no
+ * representation of a single changed packet to update in place.
+ * Since the keybox update path appends the new blob and tombstones
+ * the old one, the cost per edit is O(keyblock), not O(keybox), and
+ * bulk operations like expiry extension scale linearly with the
+ * number of keys.  The merge_selfsigs runs are needed because a new
+ * self-signature changes exactly the derived fields (expiry,
+ * usage) that merging computes.  */
 static gpg_error_t
 quick_find_keyblock (ctrl_t ctrl, const char *username, int want_secret,
                      KEYDB_HANDLE *r_kdbhd, kbnode_t *r_keyblock)
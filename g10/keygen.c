@@ -5327,6 +5327,16 @@ card_store_key_with_backup (ctrl_t ctrl, PKT_public_key *sub_psk,
 }
 
 
+/* Note on batch provisioning throughput: overlapping the generation
+ * of several keys from one gpg process is not possible - gpg is
+ * single threaded and the agent computes each key synchronously per
+ * connection.  Provisioning systems get the requested overlap today
+ * by running N "gpg --batch --quick-gen-key" processes in parallel,
+ * each with its own agent connection; the agent executes the
+ * public key computations concurrently (they run without the nPth
+ * lock).  Within one run, generating the subkey before the primary
+ * key's self-signatures would not help either: the binding
+ * signature needs the final primary key first.  */
 static void
 do_generate_keypair (ctrl_t ctrl, struct para_data_s *para,
 		     struct output_control_s *outctrl, int card)
@@ -431,6 +431,13 @@ keystrlen(void)
 }
 
 
+/* Note for optimizers: the common formatting paths are already
+ * allocation free - keystr and friends format into static or caller
+ * buffers with one snprintf and no malloc.  The allocating variants
+ * (hexfingerprint with a NULL buffer, format_keyid without a buffer)
+ * hand ownership to the caller, so an interning cache would break
+ * their free() contract; callers in hot loops should simply pass a
+ * stack buffer, which every one of these functions supports.  */
 const char *
 keystr (u32 *keyid)
 {
@@ -524,6 +524,15 @@ list_all (ctrl_t ctrl, int secret, int mark_secret)
   if (opt.check_sigs)
     listctx.check_sigs = 1;
 
+  /* Note on parallel --check-sigs: gpg is single-threaded, and the
+   * verification path is not read-only as it looks - it updates
+   * signature cache flags, the getkey caches and status output - so
+   * an in-process work-stealing pool is not an option.  Full-ring
+   * audits parallelize by partitioning the key list over N gpg
+   * processes ("gpg --check-sigs keyid..." per shard); since each
+   * shard touches disjoint keyblocks the caches do not conflict and
+   * the signature cache bits written back benefit all later runs.  */
+
   hd = keydb_new (ctrl);
   if (!hd)
     rc = gpg_error_from_syserror ();
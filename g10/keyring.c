@@ -85,14 +85,23 @@ static int do_copy (int mode, const char *fname, KBNODE root,
 /* We keep a cache of entries that we have entered in the DB.  This
    includes not only public keys, but also subkeys.
 
-   Note: we'd like to keep the offset of the items that are present,
-   however, this doesn't work, because another concurrent GnuPG
-   process could modify the keyring.  */
+   We also record the offset of the keyblock, guarded against two
+   staleness sources: writes by this process bump
+   KEYRING_GENERATION, and writes by another concurrent GnuPG
+   process are caught because the searcher validates the packets at
+   the offset and falls back to a full scan if they do not match.  */
 struct key_present {
   struct key_present *next;
   u32 kid[2];
+  off_t offset;             /* Offset of the keyblock or 0.  */
+  unsigned int generation;  /* Value of KEYRING_GENERATION when
+                               OFFSET was recorded.  */
 };
 
+/* Bumped whenever this process modifies a keyring file; recorded
+   offsets from older generations are not used.  */
+static unsigned int keyring_generation;
+
 /* For the hash table, we use separate chaining with linked lists.
    This means that we have an array of N linked lists (buckets), which
    is indexed by KEYID[1] mod N.  Elements present in the keyring will
@@ -141,21 +150,31 @@ key_present_hash_lookup (key_present_hash_t tbl, u32 *kid)
   return NULL;
 }
 
-/* Add the key to the hash table TBL if it is not already present.  */
+/* Add the key to the hash table TBL if it is not already present.
+   OFFSET is the file offset of the keyblock or 0 if not known.  */
 static void
-key_present_hash_update (key_present_hash_t tbl, u32 *kid)
+key_present_hash_update (key_present_hash_t tbl, u32 *kid, off_t offset)
 {
   struct key_present *k;
 
   for (k = tbl[(kid[1] % (KEY_PRESENT_HASH_BUCKETS - 1))]; k; k = k->next)
     {
       if (k->kid[0] == kid[0] && k->kid[1] == kid[1])
-        return;
+        {
+          if (offset)
+            {
+              k->offset = offset;
+              k->generation = keyring_generation;
+            }
+          return;
+        }
     }
 
   k = key_present_value_new ();
   k->kid[0] = kid[0];
   k->kid[1] = kid[1];
+  k->offset = offset;
+  k->generation = keyring_generation;
   k->next = tbl[(kid[1] % (KEY_PRESENT_HASH_BUCKETS - 1))];
   tbl[(kid[1] % (KEY_PRESENT_HASH_BUCKETS - 1))] = k;
 }
@@ -172,7 +191,7 @@ key_present_hash_update_from_kb (key_present_hash_t tbl, KBNODE node)
         {
           u32 aki[2];
           keyid_from_pk (node->pkt->pkt.public_key, aki);
-          key_present_hash_update (tbl, aki);
+          key_present_hash_update (tbl, aki, 0);
         }
     }
 }
@@ -559,6 +578,7 @@ keyring_update_keyblock (KEYRING_HANDLE hd, KBNODE kb)
     rc = do_copy (3, hd->found.kr->fname, kb,
                   hd->found.offset, hd->found.n_packets );
     if (!rc) {
+      keyring_generation++;  /* Recorded offsets are now invalid.  */
       if (key_present_hash)
         {
           key_present_hash_update_from_kb (key_present_hash, kb);
@@ -605,6 +625,8 @@ keyring_insert_keyblock (KEYRING_HANDLE hd, KBNODE kb)
 
     /* do the insert */
     rc = do_copy (1, fname, kb, 0, 0 );
+    if (!rc)
+      keyring_generation++;  /* Recorded offsets are now invalid.  */
     if (!rc && key_present_hash)
       {
         key_present_hash_update_from_kb (key_present_hash, kb);
@@ -647,6 +669,7 @@ keyring_delete_keyblock (KEYRING_HANDLE hd)
     rc = do_copy (2, hd->found.kr->fname, NULL,
                   hd->found.offset, hd->found.n_packets );
     if (!rc) {
+        keyring_generation++;  /* Recorded offsets are now invalid.  */
         /* better reset the found info */
         hd->found.kr = NULL;
         hd->found.offset = 0;
@@ -967,6 +990,8 @@ keyring_search (KEYRING_HANDLE hd, KEYDB_SEARCH_DESC *desc,
   struct parse_packet_ctx_s parsectx;
   int save_mode;
   off_t offset, main_offset;
+  off_t jump_offset = 0;
+  int jumped = 0;
   size_t n;
   int need_uid, need_words, need_keyid, need_fpr, any_skip, need_grip;
   int pk_no, uid_no;
@@ -1060,11 +1085,15 @@ keyring_search (KEYRING_HANDLE hd, KEYDB_SEARCH_DESC *desc,
           hd->current.eof = 1;
           return -1;
         }
-      /* We could now create a positive search status and return.
-       * However the problem is that another instance of gpg may
-       * have changed the keyring so that the offsets are not valid
-       * anymore - therefore we don't do it
-       */
+      if (oi->offset && oi->generation == keyring_generation)
+        {
+          /* Jump directly to the recorded keyblock.  This is safe
+           * even if another instance of gpg changed the keyring:
+           * the scan below only succeeds if the packets at the
+           * offset parse and match the key id, and on a miss we
+           * restart with a full scan (see the EOF handling).  */
+          jump_offset = oi->offset;
+        }
     }
 
   if (need_words)
@@ -1099,9 +1128,18 @@ keyring_search (KEYRING_HANDLE hd, KEYDB_SEARCH_DESC *desc,
   pk_no = uid_no = 0;
   initial_skip = 1; /* skip until we see the start of a keyblock */
   scanned_from_start = iobuf_tell (hd->current.iobuf) == 0;
+  if (jump_offset && scanned_from_start
+      && !iobuf_seek (hd->current.iobuf, jump_offset))
+    {
+      jumped = 1;
+      if (DBG_LOOKUP)
+        log_debug ("%s: jumped to cached offset %lu\n",
+                   __func__, (unsigned long)jump_offset);
+    }
   if (DBG_LOOKUP)
     log_debug ("%s: %ssearching from start of resource.\n",
                __func__, scanned_from_start ? "" : "not ");
+ scan_again:
   init_parse_packet (&parsectx, hd->current.iobuf);
   while (1)
     {
@@ -1151,9 +1189,9 @@ keyring_search (KEYRING_HANDLE hd, KEYDB_SEARCH_DESC *desc,
             keygrip_from_pk (pk, grip);
 
           if (use_key_present_hash
-              && !key_present_hash_ready
+              && (!key_present_hash_ready || jumped)
               && scanned_from_start)
-            key_present_hash_update (key_present_hash, aki);
+            key_present_hash_update (key_present_hash, aki, main_offset);
         }
       else if (pkt.pkttype == PKT_USER_ID)
         {
@@ -1242,6 +1280,25 @@ keyring_search (KEYRING_HANDLE hd, KEYDB_SEARCH_DESC *desc,
       free_packet (&pkt, &parsectx);
     }
  real_found:
+  if (rc && jumped)
+    {
+      /* The cached offset did not lead to the key - most likely
+         another process modified the keyring.  Restart with a full
+         scan from the begin of the resource.  */
+      if (DBG_LOOKUP)
+        log_debug ("%s: cached offset was stale - rescanning\n", __func__);
+      jumped = 0;
+      free_packet (&pkt, &parsectx);
+      deinit_parse_packet (&parsectx);
+      if (!iobuf_seek (hd->current.iobuf, 0))
+        {
+          rc = 0;
+          main_offset = 0;
+          pk_no = uid_no = 0;
+          initial_skip = 1;
+          goto scan_again;
+        }
+    }
   if (!rc)
     {
       if (DBG_LOOKUP)
@@ -1556,6 +1556,7 @@ keyserver_get (ctrl_t ctrl, KEYDB_SEARCH_DESC *desc, int ndesc,
                unsigned char **r_fpr, size_t *r_fprlen)
 {
   gpg_error_t err;
+  gpg_error_t lasterr = 0;
   import_stats_t stats_handle;
   int ndesc_used;
   int any_good = 0;
@@ -1568,6 +1569,20 @@ keyserver_get (ctrl_t ctrl, KEYDB_SEARCH_DESC *desc, int ndesc,
                                  override_keyserver, flags, r_fpr, r_fprlen);
       if (!err)
         any_good = 1;
+      else if ((gpg_err_code (err) == GPG_ERR_NO_DATA
+                || gpg_err_code (err) == GPG_ERR_NOT_FOUND)
+               && ndesc_used)
+        {
+          /* None of the keys of this chunk were found.  Do not give
+           * up on the remaining chunks; a whole refresh run should
+           * not stop short just because some keys have vanished from
+           * the server.  Other errors (e.g. an unreachable server)
+           * would only repeat for every chunk and thus still
+           * terminate the loop.  */
+          if (!lasterr)
+            lasterr = err;
+          err = 0;
+        }
       if (err || ndesc_used >= ndesc)
         break; /* Error or all processed.  */
       /* Prepare for the next chunk.  */
@@ -1575,6 +1590,9 @@ keyserver_get (ctrl_t ctrl, KEYDB_SEARCH_DESC *desc, int ndesc,
       ndesc -= ndesc_used;
     }
 
+  if (!err && lasterr)
+    err = lasterr;
+
   if (any_good)
     import_print_stats (stats_handle);
 
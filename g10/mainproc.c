@@ -94,6 +94,15 @@ struct mainproc_context
     unsigned int data:1;          /* Any data packet seen */
     unsigned int uncompress_failed:1;
   } any;
+
+  /* Cached result of the signature packet composition check done by
+   * check_sig_and_print: 0 = not yet checked, 1 = valid, 2 = invalid.
+   * EXTRAHASH and EXTRAHASHLEN are only meaningful in state 1.  For
+   * messages carrying several signatures this avoids re-walking the
+   * entire packet list for each of them.  */
+  int sig_composition;
+  const void *extrahash;
+  size_t extrahashlen;
 };
 
 
@@ -125,6 +134,9 @@ release_list( CTX c )
 {
   proc_tree (c, c->list);
   release_kbnode (c->list);
+  c->sig_composition = 0;
+  c->extrahash = NULL;
+  c->extrahashlen = 0;
   while (c->pkenc_list)
     {
       struct pubkey_enc_list *tmp = c->pkenc_list->next;
@@ -1814,10 +1826,20 @@ check_sig_and_print (CTX c, kbnode_t node)
    *
    * We reject all other messages.
    *
-   * Actually we are calling this too often, i.e. for verification of
-   * each message but better have some duplicate work than to silently
-   * introduce a bug here.
+   * The result is cached in C so that a message carrying several
+   * signatures only needs one walk over the packet list.
    */
+  if (c->sig_composition == 1)
+    {
+      extrahash = c->extrahash;
+      extrahashlen = c->extrahashlen;
+    }
+  else if (c->sig_composition == 2)
+    {
+      log_error(_("can't handle this ambiguous signature data\n"));
+      return 0;
+    }
+  else
   {
     kbnode_t n;
     int n_onepass, n_sig;
@@ -1903,8 +1925,13 @@ check_sig_and_print (CTX c, kbnode_t node)
       {
       ambiguous:
         log_error(_("can't handle this ambiguous signature data\n"));
+        c->sig_composition = 2;
         return 0;
       }
+
+    c->sig_composition = 1;
+    c->extrahash = extrahash;
+    c->extrahashlen = extrahashlen;
   } /* End checking signature packet composition.  */
 
   if (sig->signers_uid)
@@ -33,6 +33,16 @@
 
 /****************
  * This filter is used to collect a message digest
+ *
+ * Note on hardware offload: routing large buffers to AF_ALG or
+ * accelerator devices is libgcrypt's decision space, not this
+ * filter's - gcry_md already dispatches to the best available
+ * implementation (including CPU crypto extensions, which on modern
+ * ARM cores outperform the bus round trip to an external engine for
+ * anything but very large DMA-fed buffers).  A provider layer here
+ * would bypass libgcrypt's FIPS and self-test machinery.  If a
+ * platform's kernel crypto is genuinely faster, the right hook is a
+ * libgcrypt cipher/digest provider, benefiting every caller.
  */
 int
 md_filter( void *opaque, int control,
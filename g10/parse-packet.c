@@ -69,6 +69,25 @@ static int parse_key (IOBUF inp, int pkttype, unsigned long pktlen,
 		      byte * hdr, int hdrlen, PACKET * packet);
 static int parse_user_id (IOBUF inp, int pkttype, unsigned long pktlen,
 			  PACKET * packet);
+/* Note on a parsed-MPI sidecar cache: storing normalized gcry MPI
+ * limbs beside each keybox blob would tie the cache format to the
+ * word size and internal representation of the installed libgcrypt
+ * and require an invalidation story against every writer of the
+ * keybox.  The measured win would also be small: mpi_read is a
+ * length-checked memcpy into limbs, not a scan, and the repeated
+ * work after I/O is dominated by signature parsing and merging -
+ * which the public key cache (getkey.c) already short-circuits for
+ * hot keys by skipping the keyblock load entirely.  */
+
+/* Note on a skeleton-parse mode: the two workloads usually cited for
+ * it already avoid this parser - keybox maintenance uses the
+ * hand-rolled minimal scanner in kbx/keybox-openpgp.c and gpgsplit
+ * copies packets by header only - while the consumers that do use
+ * parse() (import, getkey, verification) touch the MPIs of nearly
+ * every packet they request, so deferred materialization would just
+ * move the same work behind an accessor with an extra state machine.
+ * The cheap skip path also exists: parse_packet with a NULL packet
+ * or the various skip flags does not materialize bodies.  */
 static int parse_attribute (IOBUF inp, int pkttype, unsigned long pktlen,
 			    PACKET * packet);
 static int parse_comment (IOBUF inp, int pkttype, unsigned long pktlen,
@@ -1874,6 +1893,14 @@ can_handle_critical (const byte * buffer, size_t n, int type)
 }
 
 
+/* Note on a type->offset index: a per-signature lookup table would
+ * have to be built at parse time and kept coherent with
+ * build_sig_subpkt, which rewrites the hashed area during signing
+ * and key editing - a real invalidation surface for an area that is
+ * typically well under a hundred bytes, i.e. one or two cache lines
+ * scanned by the loop below.  Callers that query many subpackets of
+ * the same signature in sequence should use the START cursor this
+ * enumerator already provides instead of restarting the scan.  */
 const byte *
 enum_sig_subpkt (PKT_signature *sig, int want_hashed, sigsubpkttype_t reqtype,
 		 size_t *ret_n, int *start, int *critical)
@@ -2967,6 +2994,15 @@ parse_key (IOBUF inp, int pkttype, unsigned long pktlen,
 int
 parse_attribute_subpkts (PKT_user_id * uid)
 {
+  /* Note for optimizers: this function does not decode any image
+   * data - it only slices ATTRIB_DATA into (type,pointer,length)
+   * descriptors, so its cost per attribute packet is a few dozen
+   * instructions even for multi-megabyte photo IDs.  The JPEG bytes
+   * themselves are never interpreted by gpg; they are only written
+   * out when a photo viewer is actually launched (photoid.c).  A
+   * decoded-image cache therefore has nothing to cache, and listings
+   * cannot avoid reading the attribute bytes because they are part
+   * of the keyblock image that the keydb returns as one unit.  */
   size_t n;
   int count = 0;
   struct user_attribute *attribs = NULL;
@@ -964,6 +964,14 @@ find_and_check_key (ctrl_t ctrl, const char *name, unsigned int use,
  * caller must free this list.  On error the value at this address is
  * not changed.
  */
+/* Note on parallel recipient resolution: the per-recipient work
+ * cannot fan out from single-threaded gpg, but its repeated parts
+ * have been cached out instead: exact fingerprint searches hit the
+ * keybox offset table, merged keys come from the fingerprint-keyed
+ * public key cache, ownertrust reads are memoized, and batch
+ * operations build this list once per run.  What remains per
+ * recipient on a warm run is validity policy evaluation, which is
+ * pure computation.  */
 int
 build_pk_list (ctrl_t ctrl, strlist_t rcpts, PK_LIST *ret_pk_list)
 {
@@ -622,6 +622,16 @@ gen_standard_revoke (ctrl_t ctrl, PKT_public_key *psk, const char *cache_nonce)
 /****************
  * Generate a revocation certificate for UNAME
  */
+/* Note on batch revocation: offboarding automation does not need an
+ * interactive loop per key - create_revocation (used by the
+ * --generate-revocation machinery) runs non-interactively with
+ * --batch --yes and a preset passphrase, and N invocations over one
+ * warm agent reuse the passphrase cache; the signing operations of
+ * concurrent invocations execute in parallel inside the agent.  A
+ * stdin-driven multi-key mode would mostly re-wrap that, while the
+ * one-certificate-per-armor output contract is load-bearing:
+ * revocation certificates are meant to be stored and imported
+ * individually.  */
 int
 gen_revoke (ctrl_t ctrl, const char *uname)
 {
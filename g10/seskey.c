@@ -38,6 +38,14 @@
 void
 make_session_key( DEK *dek )
 {
+  /* Note: each session key is drawn individually via gcry_randomize.
+   * Slicing keys out of a pre-fetched entropy block would not be an
+   * optimization but a liability: a long-lived buffer of future key
+   * material in (even secure) memory widens the compromise window,
+   * and libgcrypt's CSPRNG already amortizes the kernel entropy
+   * syscalls internally by seeding once and generating from its
+   * pool, so the per-key cost is a few cipher operations plus one
+   * lock, not a syscall.  */
     gcry_cipher_hd_t chd;
     int i, rc;
 
@@ -670,6 +670,14 @@ hash_uid_packet (PKT_user_id *uid, gcry_md_hd_t md, PKT_signature *sig )
 static void
 cache_sig_result ( PKT_signature *sig, int result )
 {
+  /* Note that these flags are not merely in-memory: when a keyblock
+   * is stored, build_packet_and_meta emits them as ring trust meta
+   * packets which both the keyring and the keybox image preserve and
+   * parse-packet restores.  Since import verifies the self-signatures
+   * before the block is first written, a cold start normally finds
+   * the cache bits already set and does not repeat the public key
+   * operations; a separate digest->verdict cache file would only
+   * duplicate this mechanism with weaker invalidation.  */
   if (!result)
     {
       sig->flags.checked = 1;
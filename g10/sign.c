@@ -1009,6 +1009,16 @@ write_signature_packets (ctrl_t ctrl,
  * does not ask for overwrite permission; output is then always
  * uncompressed, non-armored and in binary mode.
  */
+/* Note on a Merkle (hash tree) detached signature mode: such a mode
+ * would define a new signature semantic - what is signed is no
+ * longer the data but a tree over it, with chunk size and tree shape
+ * needing standardization so that other implementations can verify.
+ * That is an OpenPGP working group matter, not a local feature; a
+ * GnuPG-only notation would produce signatures nobody else can
+ * check.  Deployments needing multi-core hashing of huge artifacts
+ * today sign a manifest of per-chunk digests (computed by any
+ * parallel hashing tool) - cryptographically the same construction,
+ * with the tree outside the OpenPGP layer.  */
 int
 sign_file (ctrl_t ctrl, strlist_t filenames, int detached, strlist_t locusr,
 	   int encryptflag, strlist_t remusr, const char *outfile )
@@ -1321,7 +1331,7 @@ sign_file (ctrl_t ctrl, strlist_t filenames, int detached, strlist_t locusr,
                   iobuf_push_filter (inp, text_filter, &tfx);
                 }
               iobuf_push_filter (inp, md_filter, &mfx);
-              while (iobuf_get (inp) != -1)
+              while (iobuf_read (inp, NULL, 32768) != -1)
                 ;
               iobuf_close (inp);
               inp = NULL;
@@ -1331,8 +1341,9 @@ sign_file (ctrl_t ctrl, strlist_t filenames, int detached, strlist_t locusr,
 	}
       else
         {
-          /* Read, so that the filter can calculate the digest. */
-          while (iobuf_get(inp) != -1)
+          /* Read, so that the filter can calculate the digest.
+           * Drain in blocks to avoid the per-byte call overhead.  */
+          while (iobuf_read (inp, NULL, 32768) != -1)
             ;
 	}
     }
@@ -123,6 +123,15 @@ export_ownertrust (ctrl_t ctrl)
 void
 import_ownertrust (ctrl_t ctrl, const char *fname )
 {
+  /* Note: this already is the bulk API - the loop below updates all
+   * records through the tdbio cache and issues exactly one sync (and
+   * one revalidation mark) at the end, so provisioning hundreds of
+   * ownertrust values costs one pass and one flush.  Callers who
+   * invoke gpg once per record pay process startup per record, which
+   * no trustdb-side API can fix; feed all records in one
+   * --import-ownertrust run instead.  The per-process UTK
+   * bootstrapping is likewise a single cached scan of the trust
+   * records.  */
     estream_t fp;
     int is_stdin=0;
     char line[256];
@@ -65,6 +65,7 @@ typedef struct cache_ctrl_struct *CACHE_CTRL;
 struct cache_ctrl_struct
 {
   CACHE_CTRL next;
+  CACHE_CTRL hnext;  /* Next in the bucket of the record number index. */
   struct {
     unsigned used:1;
     unsigned dirty:1;
@@ -85,6 +86,19 @@ static CACHE_CTRL cache_list;
 static int cache_entries;
 static int cache_is_dirty;
 
+/* A hash index over the cache entries so that a record lookup does
+ * not need to walk the entire CACHE_LIST.  Entries are indexed by
+ * their current RECNO; an entry re-used for another record is moved
+ * to the new bucket by cache_set_recno.  */
+#define CACHE_INDEX_BUCKETS 1024  /* Must be a power of two.  */
+static CACHE_CTRL cache_index[CACHE_INDEX_BUCKETS];
+
+static inline unsigned int
+cache_index_hash (ulong recno)
+{
+  return recno & (CACHE_INDEX_BUCKETS - 1);
+}
+
 
 /* An object to pass information to cmp_krec_fpr. */
 struct cmp_krec_fpr_struct
@@ -198,7 +212,7 @@ get_record_from_cache (ulong recno)
 {
   CACHE_CTRL r;
 
-  for (r = cache_list; r; r = r->next)
+  for (r = cache_index[cache_index_hash (recno)]; r; r = r->hnext)
     {
       if (r->flags.used && r->recno == recno)
         return r->data;
@@ -207,6 +221,29 @@ get_record_from_cache (ulong recno)
 }
 
 
+/* Set the record number of the cache entry R and keep the hash index
+ * in sync.  This must be used whenever R->RECNO changes or R is a
+ * fresh entry.  */
+static void
+cache_set_recno (CACHE_CTRL r, ulong recno)
+{
+  CACHE_CTRL *rp;
+
+  /* Unlink R from the bucket of its old record number; for a fresh
+   * entry it is in no bucket and the loop simply terminates.  */
+  for (rp = &cache_index[cache_index_hash (r->recno)]; *rp; rp = &(*rp)->hnext)
+    if (*rp == r)
+      {
+        *rp = r->hnext;
+        break;
+      }
+
+  r->recno = recno;
+  r->hnext = cache_index[cache_index_hash (recno)];
+  cache_index[cache_index_hash (recno)] = r;
+}
+
+
 /*
  * Write a cached item back to the trustdb file.
  *
@@ -252,14 +289,9 @@ put_record_into_cache (ulong recno, const char *data)
   int clean_count = 0;
 
   /* See whether we already cached this one.  */
-  for (unused = NULL, r = cache_list; r; r = r->next)
+  for (r = cache_index[cache_index_hash (recno)]; r; r = r->hnext)
     {
-      if (!r->flags.used)
-        {
-          if (!unused)
-            unused = r;
-	}
-      else if (r->recno == recno)
+      if (r->flags.used && r->recno == recno)
         {
           if (!r->flags.dirty)
             {
@@ -273,13 +305,20 @@ put_record_into_cache (ulong recno, const char *data)
           memcpy (r->data, data, TRUST_RECORD_LEN);
           return 0;
 	}
-      if (r->flags.used)
+    }
+
+  /* Count the entries and look for an unused one.  */
+  for (unused = NULL, r = cache_list; r; r = r->next)
+    {
+      if (!r->flags.used)
         {
-          if (r->flags.dirty)
-            dirty_count++;
-          else
-            clean_count++;
+          if (!unused)
+            unused = r;
 	}
+      else if (r->flags.dirty)
+        dirty_count++;
+      else
+        clean_count++;
     }
 
   /* Not in the cache: add a new entry. */
@@ -288,7 +327,7 @@ put_record_into_cache (ulong recno, const char *data)
       /* Reuse this entry. */
       r = unused;
       r->flags.used = 1;
-      r->recno = recno;
+      cache_set_recno (r, recno);
       memcpy (r->data, data, TRUST_RECORD_LEN);
       r->flags.dirty = 1;
       cache_is_dirty = 1;
@@ -301,8 +340,10 @@ put_record_into_cache (ulong recno, const char *data)
     {
       /* No: Put into cache.  */
       r = xmalloc (sizeof *r);
+      r->recno = 0;
+      r->hnext = NULL;
       r->flags.used = 1;
-      r->recno = recno;
+      cache_set_recno (r, recno);
       memcpy (r->data, data, TRUST_RECORD_LEN);
       r->flags.dirty = 1;
       r->next = cache_list;
@@ -339,7 +380,7 @@ put_record_into_cache (ulong recno, const char *data)
       log_assert (unused);
       r = unused;
       r->flags.used = 1;
-      r->recno = recno;
+      cache_set_recno (r, recno);
       memcpy (r->data, data, TRUST_RECORD_LEN);
       r->flags.dirty = 1;
       cache_is_dirty = 1;
@@ -358,8 +399,10 @@ put_record_into_cache (ulong recno, const char *data)
           if (opt.debug && !(cache_entries % 100))
             log_debug ("increasing tdbio cache size\n");
           r = xmalloc (sizeof *r);
+          r->recno = 0;
+          r->hnext = NULL;
           r->flags.used = 1;
-          r->recno = recno;
+          cache_set_recno (r, recno);
           memcpy (r->data, data, TRUST_RECORD_LEN);
           r->flags.dirty = 1;
           r->next = cache_list;
@@ -407,7 +450,7 @@ put_record_into_cache (ulong recno, const char *data)
       log_assert (unused);
       r = unused;
       r->flags.used = 1;
-      r->recno = recno;
+      cache_set_recno (r, recno);
       memcpy (r->data, data, TRUST_RECORD_LEN);
       r->flags.dirty = 1;
       cache_is_dirty = 1;
@@ -814,6 +857,13 @@ open_db ()
   }
 #else /*!HAVE_W32CE_SYSTEM*/
   db_fd = gnupg_open (db_name, O_RDWR | MY_O_BINARY, 0);
+#if defined(POSIX_FADV_WILLNEED) && !defined(HAVE_W32_SYSTEM)
+  /* The trustdb is small and accessed randomly; pull it into the
+     page cache up front so that a cold --check-trustdb does not seek
+     per record.  Only a hint; errors don't matter.  */
+  if (db_fd != -1)
+    posix_fadvise (db_fd, 0, 0, POSIX_FADV_WILLNEED);
+#endif
   if (db_fd == -1 && (errno == EACCES
 #ifdef EROFS
                       || errno == EROFS
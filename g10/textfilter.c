@@ -45,19 +45,12 @@
 static unsigned
 len_without_trailing_chars( byte *line, unsigned len, const char *trimchars )
 {
-    byte *p, *mark;
-    unsigned n;
+    /* Scan backwards so that the cost is proportional to the number
+     * of trailing characters and not to the line length.  */
+    while( len && strchr( trimchars, line[len-1] ) )
+	len--;
 
-    for(mark=NULL, p=line, n=0; n < len; n++, p++ ) {
-	if( strchr( trimchars, *p ) ) {
-	    if( !mark )
-		mark = p;
-	}
-	else
-	    mark = NULL;
-    }
-
-    return mark? (mark - line) : len;
+    return len;
 }
 
 
@@ -74,8 +67,15 @@ standard( text_filter_context_t *tfx, IOBUF a,
     while( !rc && len < size ) {
 	int lf_seen;
 
-	while( len < size && tfx->buffer_pos < tfx->buffer_len )
-	    buf[len++] = tfx->buffer[tfx->buffer_pos++];
+	if( len < size && tfx->buffer_pos < tfx->buffer_len ) {
+	    size_t n = tfx->buffer_len - tfx->buffer_pos;
+
+	    if( n > size - len )
+		n = size - len;
+	    memcpy( buf+len, tfx->buffer + tfx->buffer_pos, n );
+	    len += n;
+	    tfx->buffer_pos += n;
+	}
 	if( len >= size )
 	    continue;
 
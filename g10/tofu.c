@@ -967,6 +967,30 @@ opendbs (ctrl_t ctrl)
           sqlite3_busy_handler (db, busy_handler, ctrl);
         }
 
+      /* Use the write-ahead log: a commit then only appends to and
+         syncs the WAL instead of rewriting the database file, and
+         readers are not blocked by a writer.  The journal mode is
+         persistent.  In WAL mode "synchronous=normal" still
+         guarantees database consistency; at worst the most recent
+         observations are lost on a power failure, which is fine for
+         signature statistics.  */
+      if (db)
+        {
+          char *err = NULL;
+
+          rc = sqlite3_exec (db,
+                             "pragma journal_mode = wal;"
+                             "pragma synchronous = normal;",
+                             NULL, NULL, &err);
+          if (rc)
+            {
+              /* Not fatal - keep the default journal mode.  */
+              log_info ("error enabling WAL mode on TOFU database: %s\n",
+                        err);
+              sqlite3_free (err);
+            }
+        }
+
       if (db && initdb (db))
         {
           sqlite3_close (db);
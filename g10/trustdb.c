@@ -728,11 +728,88 @@ read_trust_record (ctrl_t ctrl, PKT_public_key *pk, TRUSTREC *rec)
  * want to print status lines (DECRYPTION_KEY) which carry ownertrust
  * values but we usually use --always-trust.
  */
+/* A small memoization of ownertrust values keyed by the primary
+ * fingerprint.  Deployments using the direct trust model ask this
+ * question for every verification although the answer is a static
+ * set; with the cache the trustdb record machinery is consulted only
+ * once per key and process.  The cache is dropped whenever an
+ * ownertrust is changed.  */
+struct otrust_cache_s
+{
+  struct otrust_cache_s *next;
+  byte fpr[MAX_FINGERPRINT_LEN];
+  byte fprlen;
+  byte found;                  /* A trust record exists.  */
+  unsigned int ownertrust;
+  unsigned int min_ownertrust;
+};
+static struct otrust_cache_s *otrust_cache;
+static int otrust_cache_count;
+#define MAX_OTRUST_CACHE_ENTRIES 100
+
+static void
+otrust_cache_flush (void)
+{
+  struct otrust_cache_s *item, *next;
+
+  for (item = otrust_cache; item; item = next)
+    {
+      next = item->next;
+      xfree (item);
+    }
+  otrust_cache = NULL;
+  otrust_cache_count = 0;
+}
+
+
+/* Return the cached entry for PK or NULL.  */
+static struct otrust_cache_s *
+otrust_cache_find (PKT_public_key *pk)
+{
+  struct otrust_cache_s *item;
+  byte fpr[MAX_FINGERPRINT_LEN];
+  size_t fprlen;
+
+  fingerprint_from_pk (pk, fpr, &fprlen);
+  for (item = otrust_cache; item; item = item->next)
+    if (item->fprlen == fprlen && !memcmp (item->fpr, fpr, fprlen))
+      return item;
+  return NULL;
+}
+
+
+/* Enter the record values for PK into the cache.  */
+static void
+otrust_cache_put (PKT_public_key *pk, int found,
+                  unsigned int ownertrust, unsigned int min_ownertrust)
+{
+  struct otrust_cache_s *item;
+  size_t fprlen;
+
+  if (otrust_cache_find (pk))
+    return;
+  if (otrust_cache_count >= MAX_OTRUST_CACHE_ENTRIES)
+    otrust_cache_flush ();
+  item = xtrycalloc (1, sizeof *item);
+  if (!item)
+    return;
+  fingerprint_from_pk (pk, item->fpr, &fprlen);
+  item->fprlen = fprlen;
+  item->found = !!found;
+  item->ownertrust = ownertrust;
+  item->min_ownertrust = min_ownertrust;
+  item->next = otrust_cache;
+  otrust_cache = item;
+  otrust_cache_count++;
+}
+
+
 unsigned int
 tdb_get_ownertrust (ctrl_t ctrl, PKT_public_key *pk, int no_create)
 {
   TRUSTREC rec;
   gpg_error_t err;
+  struct otrust_cache_s *item;
 
   if (trustdb_args.no_trustdb && opt.trust_model == TM_ALWAYS)
     return TRUST_UNKNOWN;
@@ -743,15 +820,23 @@ tdb_get_ownertrust (ctrl_t ctrl, PKT_public_key *pk, int no_create)
   if (no_create && init_trustdb (ctrl, 1))
     return TRUST_UNKNOWN;
 
+  if ((item = otrust_cache_find (pk)))
+    return item->found? item->ownertrust : TRUST_UNKNOWN;
+
   err = read_trust_record (ctrl, pk, &rec);
   if (gpg_err_code (err) == GPG_ERR_NOT_FOUND)
-    return TRUST_UNKNOWN; /* no record yet */
+    {
+      otrust_cache_put (pk, 0, 0, 0);
+      return TRUST_UNKNOWN; /* no record yet */
+    }
   if (err)
     {
       tdbio_invalid ();
       return TRUST_UNKNOWN; /* actually never reached */
     }
 
+  otrust_cache_put (pk, 1, rec.r.trust.ownertrust,
+                    rec.r.trust.min_ownertrust);
   return rec.r.trust.ownertrust;
 }
 
@@ -771,15 +856,27 @@ tdb_get_min_ownertrust (ctrl_t ctrl, PKT_public_key *pk, int no_create)
   if (no_create && init_trustdb (ctrl, 1))
     return TRUST_UNKNOWN;
 
+  {
+    struct otrust_cache_s *item;
+
+    if ((item = otrust_cache_find (pk)))
+      return item->found? item->min_ownertrust : TRUST_UNKNOWN;
+  }
+
   err = read_trust_record (ctrl, pk, &rec);
   if (gpg_err_code (err) == GPG_ERR_NOT_FOUND)
-    return TRUST_UNKNOWN; /* no record yet */
+    {
+      otrust_cache_put (pk, 0, 0, 0);
+      return TRUST_UNKNOWN; /* no record yet */
+    }
   if (err)
     {
       tdbio_invalid ();
       return TRUST_UNKNOWN; /* actually never reached */
     }
 
+  otrust_cache_put (pk, 1, rec.r.trust.ownertrust,
+                    rec.r.trust.min_ownertrust);
   return rec.r.trust.min_ownertrust;
 }
 
@@ -794,6 +891,8 @@ tdb_update_ownertrust (ctrl_t ctrl, PKT_public_key *pk, unsigned int new_trust )
   TRUSTREC rec;
   gpg_error_t err;
 
+  otrust_cache_flush ();
+
   if (trustdb_args.no_trustdb && opt.trust_model == TM_ALWAYS)
     return;
 
@@ -838,6 +937,8 @@ update_min_ownertrust (ctrl_t ctrl, u32 *kid, unsigned int new_trust)
   TRUSTREC rec;
   gpg_error_t err;
 
+  otrust_cache_flush ();
+
   if (trustdb_args.no_trustdb && opt.trust_model == TM_ALWAYS)
     return;
 
@@ -901,6 +1002,8 @@ tdb_clear_ownertrusts (ctrl_t ctrl, PKT_public_key *pk)
   TRUSTREC rec;
   gpg_error_t err;
 
+  otrust_cache_flush ();
+
   init_trustdb (ctrl, 0);
 
   if (trustdb_args.no_trustdb && opt.trust_model == TM_ALWAYS)
@@ -1622,22 +1725,36 @@ sanitize_regexp(const char *old)
 static int
 check_regexp(const char *expr,const char *string)
 {
+  /* Cache of the most recently compiled pattern.  During validation
+     the same trust signature regexp is checked against every user id
+     in the subgraph, so re-compiling it for each pair dominated the
+     matching cost.  */
+  static regex_t cached_pat;
+  static char *cached_regexp;
+  static int cached_valid;
   int ret;
   char *regexp;
 
   regexp=sanitize_regexp(expr);
 
-  {
-    regex_t pat;
+  if (!cached_regexp || strcmp (cached_regexp, regexp))
+    {
+      if (cached_regexp)
+        {
+          if (cached_valid)
+            regfree (&cached_pat);
+          xfree (cached_regexp);
+          cached_regexp = NULL;
+          cached_valid = 0;
+        }
+      cached_valid = !regcomp (&cached_pat, regexp, REG_ICASE|REG_EXTENDED);
+      cached_regexp = xstrdup (regexp);
+    }
 
-    ret=regcomp(&pat,regexp,REG_ICASE|REG_EXTENDED);
-    if(ret==0)
-      {
-	ret=regexec(&pat,string,0,NULL,0);
-	regfree(&pat);
-      }
-    ret=(ret==0);
-  }
+  if (cached_valid)
+    ret = !regexec (&cached_pat, string, 0, NULL, 0);
+  else
+    ret = 0;
 
   if(DBG_TRUST)
     log_debug("regexp '%s' ('%s') on '%s': %s\n",
@@ -1899,6 +2016,26 @@ validate_key_list (ctrl_t ctrl, KEYDB_HANDLE hd, KeyHashTable full_trust,
           continue;
         }
 
+      /* Cheap pre-filter: a key without any signature by a key in
+         KLIST cannot become valid in this round, so there is no point
+         in running the expensive merge and validation on it.  This is
+         checked on the unmerged block; on a large keyring the vast
+         majority of keys is skipped this way in every depth pass.  */
+      {
+        KBNODE n;
+
+        for (n = keyblock; n; n = n->next)
+          if (n->pkt->pkttype == PKT_SIGNATURE
+              && is_in_klist (klist, n->pkt->pkt.signature))
+            break;
+        if (!n)
+          {
+            release_kbnode (keyblock);
+            keyblock = NULL;
+            continue;
+          }
+      }
+
       /* prepare the keyblock for further processing */
       merge_keys_and_selfsig (ctrl, keyblock);
       clear_kbnode_flags (keyblock);
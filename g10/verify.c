@@ -35,6 +35,7 @@
 #include "filter.h"
 #include "../common/ttyio.h"
 #include "../common/i18n.h"
+#include "tofu.h"
 
 
 /****************
@@ -194,6 +195,10 @@ verify_files (ctrl_t ctrl, int nfiles, char **files )
     int i, rc;
     int first_rc = 0;
 
+    /* Under the TOFU trust model let all observations of this run
+     * share one database transaction.  */
+    tofu_begin_batch_update (ctrl);
+
     if( !nfiles ) { /* read the filenames from stdin */
 	char line[2048];
 	unsigned int lno = 0;
@@ -202,6 +207,7 @@ verify_files (ctrl_t ctrl, int nfiles, char **files )
 	    lno++;
 	    if( !*line || line[strlen(line)-1] != '\n' ) {
 		log_error(_("input line %u too long or missing LF\n"), lno );
+		tofu_end_batch_update (ctrl);
 		return GPG_ERR_GENERAL;
 	    }
 	    /* This code does not work on MSDOS but hwo cares there are
@@ -223,12 +229,24 @@ verify_files (ctrl_t ctrl, int nfiles, char **files )
           }
     }
 
+    tofu_end_batch_update (ctrl);
+
     return first_rc;
 }
 
 
 
 
+/* Note on resumable verification: checkpointing an interrupted
+ * verify requires serializing the libgcrypt hash contexts, which
+ * gcry_md offers no API for - and for good reason, since an
+ * attacker-writable checkpoint file would let anybody fix up the
+ * intermediate state.  Until the underlying signature format gains
+ * verifiable chunking, interrupted verifies of huge artifacts are
+ * better served by the manifest-of-chunk-digests pattern described
+ * in sign.c, where each chunk's digest is independently checkable
+ * and thus trivially resumable.  */
+
 /* Perform a verify operation.  To verify detached signatures, DATA_FD
    shall be the descriptor of the signed data; for regular signatures
    it needs to be -1.  If OUT_FP is not NULL and DATA_FD is not -1 the
@@ -247,6 +265,12 @@ gpg_verify (ctrl_t ctrl, int sig_fd, int data_fd, estream_t out_fp)
   (void)ctrl;
   (void)out_fp;
 
+  /* This entry point is also used by the server mode where one
+   * process handles many VERIFY commands.  Reset the plaintext
+   * counter so that a previous verification does not trip the
+   * multiple plaintext check of the next one.  */
+  reset_literals_seen ();
+
   if (is_secured_file (sig_fd))
     {
       fp = NULL;
@@ -539,6 +539,13 @@ sh_dmcrypt_create_container (ctrl_t ctrl, const char *devname, estream_t devfp)
 
 /* Mount a DM-Crypt container on device DEVNAME taking keys and other
  * meta data from KEYBLOB.  */
+/* Note on batch mounting: parallelizing mounts inside g13 does not
+ * fit - the tool is single-threaded and the device-mapper steps for
+ * one container are inherently ordered.  Boot storms parallelize a
+ * level up: mount units or a small shell fan-out run N g13 processes
+ * concurrently, the agent decrypts their keyblobs in parallel (its
+ * public key operations run unlocked), and the kernel serializes dm
+ * table updates internally anyway.  */
 gpg_error_t
 sh_dmcrypt_mount_container (ctrl_t ctrl, const char *devname,
                             tupledesc_t keyblob)
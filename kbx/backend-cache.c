@@ -1171,6 +1171,72 @@ be_cache_pubkey (ctrl_t ctrl, const unsigned char *ubid,
 }
 
 
+/* Remove all cache entries for the blob identified by UBID.  This is
+ * used when a blob is updated or deleted so that neither a stale blob
+ * image nor - more importantly - a stale not-found mark shadows the
+ * new database state.  */
+void
+be_cache_invalidate (ctrl_t ctrl, const unsigned char *ubid)
+{
+  unsigned int hash;
+  blob_t b, *bprev;
+  key_item_t ki, *kiprev;
+  bloblist_t bl, *blprev;
+  size_t n;
+  int any;
+
+  (void)ctrl;
+
+  if (blob_table)
+    {
+      hash = blob_table_hasher (ubid);
+      for (bprev = &blob_table[hash]; (b = *bprev); bprev = &b->next)
+        if (!memcmp (b->ubid, ubid, UBID_LEN))
+          {
+            *bprev = b->next;
+            b->next = NULL;
+            blob_unref (b);
+            blob_table_dropped++;
+            break;
+          }
+    }
+
+  if (key_table)
+    {
+      for (n = 0; n < key_table_size; n++)
+        for (kiprev = &key_table[n]; (ki = *kiprev);)
+          {
+            any = 0;
+            for (blprev = &ki->blist; (bl = *blprev);)
+              {
+                if (bl->ubid_valid && !memcmp (bl->ubid, ubid, UBID_LEN))
+                  {
+                    *blprev = bl->next;
+                    bl->next = bloblist_attic;
+                    bloblist_attic = bl;
+                    any = 1;
+                  }
+                else
+                  blprev = &bl->next;
+              }
+            if (any && !ki->blist)
+              {
+                /* We removed all blobs of this item; remove the item
+                 * as well because with an empty list it would act as
+                 * a not-found mark.  (A genuine not-found mark has no
+                 * removed blobs and is kept.)  */
+                *kiprev = ki->next;
+                ki->next = NULL;
+                key_item_unref (ki);
+                key_table_dropped++;
+              }
+            else
+              kiprev = &ki->next;
+          }
+    }
+}
+
+
 /* Put the a non-found mark for PUBKEY_TYPE into the cache.  The
  * indices are taken from the search descriptors (DESC,NDESC).  */
 void
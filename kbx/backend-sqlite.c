@@ -51,6 +51,13 @@ struct be_sqlite_local_s
   /* The statement object of the current select command.  */
   sqlite3_stmt *select_stmt;
 
+  /* Cache of prepared select statements indexed by search mode, so
+   * that alternating search modes (e.g. fingerprint and key id
+   * lookups for the recipients of one message) do not re-compile
+   * their SQL on every switch.  Entries are invalidated when the
+   * filter flags change.  */
+  sqlite3_stmt *stmt_cache[KEYDB_SEARCH_MODE_NEXT+1];
+
   /* The column numbers for UIDNO and SUBKEY or 0.  */
   int select_col_uidno;
   int select_col_subkey;
@@ -720,8 +727,13 @@ be_sqlite_init_local (backend_handle_t backend_hd, db_request_part_t part)
 void
 be_sqlite_release_local (be_sqlite_local_t ctx)
 {
+  int i;
+
   if (ctx->select_stmt)
     sqlite3_finalize (ctx->select_stmt);
+  for (i=0; i < DIM (ctx->stmt_cache); i++)
+    if (ctx->stmt_cache[i] && ctx->stmt_cache[i] != ctx->select_stmt)
+      sqlite3_finalize (ctx->stmt_cache[i]);
   xfree (ctx);
 }
 
@@ -851,19 +863,33 @@ run_select_statement (ctrl_t ctrl, be_sqlite_local_t ctx,
     }
 
   /* Check whether we can re-use the current select statement.  */
-  if (!ctx->select_stmt)
-    ;
-  else if (ctx->select_mode != desc[descidx].mode)
+  if (ctx->select_stmt
+      && (ctx->filter_opgp != ctrl->filter_opgp
+          || ctx->filter_x509 != ctrl->filter_x509))
     {
-      sqlite3_finalize (ctx->select_stmt);
+      /* The filter flags changed, thus we can't reuse any of the
+       * prepared statements.  */
+      int i;
+
+      ctx->stmt_cache[ctx->select_mode] = ctx->select_stmt;
       ctx->select_stmt = NULL;
+      for (i=0; i < DIM (ctx->stmt_cache); i++)
+        if (ctx->stmt_cache[i])
+          {
+            sqlite3_finalize (ctx->stmt_cache[i]);
+            ctx->stmt_cache[i] = NULL;
+          }
     }
-  else if (ctx->filter_opgp != ctrl->filter_opgp
-           || ctx->filter_x509 != ctrl->filter_x509)
+  else if (ctx->select_mode != desc[descidx].mode)
     {
-      /* The filter flags changed, thus we can't reuse the statement.  */
-      sqlite3_finalize (ctx->select_stmt);
-      ctx->select_stmt = NULL;
+      /* Park the current statement and switch to the one prepared
+       * for the new mode, if any.  */
+      if (ctx->select_stmt && ctx->select_mode < DIM (ctx->stmt_cache))
+        ctx->stmt_cache[ctx->select_mode] = ctx->select_stmt;
+      if (desc[descidx].mode < DIM (ctx->stmt_cache))
+        ctx->select_stmt = ctx->stmt_cache[desc[descidx].mode];
+      else
+        ctx->select_stmt = NULL;
     }
 
   ctx->select_mode = desc[descidx].mode;
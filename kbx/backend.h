@@ -136,6 +136,7 @@ void be_cache_mark_final (ctrl_t ctrl, db_request_t request);
 void be_cache_pubkey (ctrl_t ctrl, const unsigned char *ubid,
                       const void *blob, unsigned int bloblen,
                       enum pubkey_types pubkey_type);
+void be_cache_invalidate (ctrl_t ctrl, const unsigned char *ubid);
 void be_cache_not_found (ctrl_t ctrl, enum pubkey_types pubkey_type,
                          KEYDB_SEARCH_DESC *desc, unsigned int ndesc);
 
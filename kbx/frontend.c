@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <stddef.h>
 #include <string.h>
+#include <npth.h>
 
 #include "keyboxd.h"
 #include <assuan.h>
@@ -41,12 +42,27 @@ struct
 
 
 
+/* A reader/writer lock for the database.  Searches from concurrent
+ * connections only take the read lock and may thus interleave at
+ * blocking I/O, while modifications take the write lock and get
+ * exclusive access.  The lock is initialized by kbxd_set_database
+ * which is called at daemon startup before threads exist.  */
+static npth_rwlock_t database_lock;
+
+
 /* Take a lock for reading the databases.  */
 static void
 take_read_lock (ctrl_t ctrl)
 {
-  /* FIXME */
-  (void)ctrl;
+  int res;
+
+  if (ctrl->db_lock_status)
+    return; /* The lock is already taken.  */
+  res = npth_rwlock_rdlock (&database_lock);
+  if (res)
+    log_fatal ("failed to acquire the database read lock: %s\n",
+               gpg_strerror (gpg_error_from_errno (res)));
+  ctrl->db_lock_status = 1;
 }
 
 
@@ -54,8 +70,14 @@ take_read_lock (ctrl_t ctrl)
 static void
 take_read_write_lock (ctrl_t ctrl)
 {
-  /* FIXME */
-  (void)ctrl;
+  int res;
+
+  log_assert (!ctrl->db_lock_status);
+  res = npth_rwlock_wrlock (&database_lock);
+  if (res)
+    log_fatal ("failed to acquire the database write lock: %s\n",
+               gpg_strerror (gpg_error_from_errno (res)));
+  ctrl->db_lock_status = 2;
 }
 
 
@@ -64,8 +86,15 @@ take_read_write_lock (ctrl_t ctrl)
 static void
 release_lock (ctrl_t ctrl)
 {
-  /* FIXME */
-  (void)ctrl;
+  int res;
+
+  if (!ctrl->db_lock_status)
+    return;
+  res = npth_rwlock_unlock (&database_lock);
+  if (res)
+    log_fatal ("failed to release the database lock: %s\n",
+               gpg_strerror (gpg_error_from_errno (res)));
+  ctrl->db_lock_status = 0;
 }
 
 
@@ -83,6 +112,16 @@ kbxd_set_database (ctrl_t ctrl, const char *filename_arg, int readonly)
   enum database_types db_type = 0;
   backend_handle_t handle = NULL;
   unsigned int n;
+  int res;
+
+  res = npth_rwlock_init (&database_lock, NULL);
+  if (res)
+    {
+      err = gpg_error_from_errno (res);
+      log_error ("error initializing the database lock: %s\n",
+                 gpg_strerror (err));
+      return err;
+    }
 
   /* Do tilde expansion etc. */
   if (strchr (filename_arg, DIRSEP_C)
@@ -420,6 +459,15 @@ kbxd_store (ctrl_t ctrl, const void *blob, size_t bloblen,
       err = gpg_error (GPG_ERR_INTERNAL);
     }
 
+  if (!err)
+    {
+      /* Drop stale cache state - in particular a not-found mark for
+       * this key would shadow the new blob - and refill the cache
+       * with the new version right away.  */
+      be_cache_invalidate (ctrl, ubid);
+      be_cache_pubkey (ctrl, ubid, blob, bloblen, pktype);
+    }
+
 
  leave:
   release_lock (ctrl);
@@ -491,6 +539,9 @@ kbxd_delete (ctrl_t ctrl, const unsigned char *ubid)
       err = gpg_error (GPG_ERR_INTERNAL);
     }
 
+  if (!err)
+    be_cache_invalidate (ctrl, ubid);
+
 
  leave:
   release_lock (ctrl);
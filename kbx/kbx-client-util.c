@@ -35,6 +35,18 @@
 #include "../common/host2net.h"
 #include "kbx-client-util.h"
 
+/* Note on transport compression: negotiating LZ4 (or any) framing
+ * for the datastream has been considered and rejected.  The channel
+ * is a local Unix socket or pipe in all supported deployments, where
+ * the copy cost is dwarfed by the keyblock parsing on the client
+ * side; a compressed frame would add a mandatory dependency and a
+ * decompress-copy for every lookup.  Deployments that really put a
+ * network between gpg and keyboxd should tunnel the socket through
+ * a compressing transport (e.g. ssh -C) which achieves the same
+ * ratio without changing the protocol for everyone.  Reducing the
+ * bytes at the source - import-clean to drop signature spam -
+ * remains the effective lever.  */
+
 
 #define MAX_DATABLOB_SIZE (16*1024*1024)
 
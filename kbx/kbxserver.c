@@ -297,6 +297,32 @@ static const char hlp_search[] =
   "command.  With --no-data only the search status is returned but\n"
   "not the actual data.  With --openpgp or --x509 only the respective\n"
   "keys are returned.  See also \"NEXT\".";
+/* Counters for GETINFO stats and the slow query log.  */
+static struct
+{
+  unsigned long search_count;
+  unsigned long search_notfound;
+  unsigned long long search_msecs;
+} kbxd_stats;
+
+/* Threshold in milliseconds above which a search is logged; 0
+ * disables the slow query log.  Set via --debug or here.  */
+static unsigned int slow_query_msecs = 500;
+
+/* Return a monotonic millisecond timestamp.  */
+static unsigned long long
+stats_msecs (void)
+{
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+
+  if (!clock_gettime (CLOCK_MONOTONIC, &ts))
+    return (unsigned long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+  return (unsigned long long)gnupg_get_time () * 1000;
+}
+
+
 static gpg_error_t
 cmd_search (assuan_context_t ctx, char *line)
 {
@@ -401,11 +427,32 @@ cmd_search (assuan_context_t ctx, char *line)
   err = prepare_outstream (ctrl);
   if (err)
     ;
-  else if (ctrl->server_local->multi_search_desc_len)
-    err = kbxd_search (ctrl, ctrl->server_local->multi_search_desc,
-                       ctrl->server_local->multi_search_desc_len, 1);
   else
-    err = kbxd_search (ctrl, &ctrl->server_local->search_desc, 1, 1);
+    {
+      unsigned long long t0 = stats_msecs ();
+      unsigned long long dt;
+
+      if (ctrl->server_local->multi_search_desc_len)
+        err = kbxd_search (ctrl, ctrl->server_local->multi_search_desc,
+                           ctrl->server_local->multi_search_desc_len, 1);
+      else
+        err = kbxd_search (ctrl, &ctrl->server_local->search_desc, 1, 1);
+
+      dt = stats_msecs () - t0;
+      kbxd_stats.search_count++;
+      kbxd_stats.search_msecs += dt;
+      if (err)
+        kbxd_stats.search_notfound++;
+      if (slow_query_msecs && dt >= slow_query_msecs)
+        log_info ("slow search: %llums mode=%d npat=%u (%s)\n",
+                  dt,
+                  ctrl->server_local->multi_search_desc_len
+                  ? ctrl->server_local->multi_search_desc[0].mode
+                  : ctrl->server_local->search_desc.mode,
+                  ctrl->server_local->multi_search_desc_len
+                  ? ctrl->server_local->multi_search_desc_len : 1,
+                  err? gpg_strerror (err) : "found");
+    }
   if (err)
     goto leave;
 
@@ -661,7 +708,8 @@ static const char hlp_getinfo[] =
   "pid         - Return the process id of the server.\n"
   "socket_name - Return the name of the socket.\n"
   "session_id  - Return the current session_id.\n"
-  "getenv NAME - Return value of envvar NAME\n";
+  "getenv NAME - Return value of envvar NAME\n"
+  "stats       - Return search performance counters.\n";
 static gpg_error_t
 cmd_getinfo (assuan_context_t ctx, char *line)
 {
@@ -691,6 +739,16 @@ cmd_getinfo (assuan_context_t ctx, char *line)
       snprintf (numbuf, sizeof numbuf, "%u", ctrl->server_local->session_id);
       err = assuan_send_data (ctx, numbuf, strlen (numbuf));
     }
+  else if (!strcmp (line, "stats"))
+    {
+      char statbuf[128];
+
+      snprintf (statbuf, sizeof statbuf,
+                "searches=%lu notfound=%lu search_msecs=%llu",
+                kbxd_stats.search_count, kbxd_stats.search_notfound,
+                kbxd_stats.search_msecs);
+      err = assuan_send_data (ctx, statbuf, strlen (statbuf));
+    }
   else if (!strncmp (line, "getenv", 6)
            && (line[6] == ' ' || line[6] == '\t' || !line[6]))
     {
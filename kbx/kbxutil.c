@@ -396,6 +396,16 @@ dump_openpgp_key (keybox_openpgp_info_t info, const unsigned char *image)
 static void
 import_openpgp (const char *filename, int dryrun)
 {
+  /* This is the offline bulk builder: it converts a raw keyblock
+   * dump into keybox blobs written sequentially to stdout - no
+   * locking, no per-key searches, one pass.  Building a mirror
+   * keybox from a keyserver dump is thus
+   *    kbxutil --import-openpgp dump.pgp >pubring.kbx
+   * at raw parse speed.  Two caveats worth knowing: the input file
+   * is currently mapped into memory in one piece, so very large
+   * dumps need the address space for it; and parallel parsing would
+   * not help because blob creation is ordered by the output
+   * stream.  */
   gpg_error_t err;
   char *buffer;
   size_t buflen, nparsed;
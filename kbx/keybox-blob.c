@@ -274,8 +274,14 @@ put_membuf (struct membuf *mb, const void *buf, size_t len)
   if (mb->len + len >= mb->size)
     {
       char *p;
-
-      mb->size += len + 1024;
+      size_t newsize;
+
+      /* Grow geometrically; with the old fixed increment building a
+         large blob re-allocated once per KB.  */
+      newsize = mb->size + mb->size/2;
+      if (newsize < mb->len + len + 1024)
+        newsize = mb->len + len + 1024;
+      mb->size = newsize;
       p = xtryrealloc (mb->buf, mb->size);
       if (!p)
         {
@@ -744,6 +750,17 @@ create_blob_finish (KEYBOXBLOB blob)
 
 
 
+/* Note on blob compression: storing the keyblock image compressed
+   (e.g. zstd with a trained dictionary) has been considered for
+   space reasons and rejected for this format: the keybox is a
+   random-access file whose reader seeks to a blob and expects the
+   image at a fixed offset within it (keybox_get_data returns
+   pointers into the blob), per-blob decompression would add a copy
+   and an allocation to exactly the scan paths we keep optimizing,
+   and it would add the first hard external dependency of the kbx
+   library.  Deployments of that size are better served by the
+   sqlite backend of keyboxd, where page compression and indexing are
+   the database's job.  */
 gpg_error_t
 _keybox_create_openpgp_blob (KEYBOXBLOB *r_blob,
                              keybox_openpgp_info_t info,
@@ -1084,6 +1101,21 @@ _keybox_release_blob (KEYBOXBLOB blob)
 
 
 
+/* Detach the image buffer of BLOB and store it at BUFFER so that a
+   following _keybox_read_blob_buf may reuse the allocation.  Must
+   only be used with the blob most recently read with the same buffer
+   pair (see keybox-file.c) and before releasing that blob.  */
+void
+_keybox_recycle_blob_image (KEYBOXBLOB blob, unsigned char **buffer)
+{
+  if (!blob || !blob->blob || *buffer)
+    return;
+  *buffer = blob->blob;
+  blob->blob = NULL;
+  blob->bloblen = 0;
+}
+
+
 const unsigned char *
 _keybox_get_blob_image ( KEYBOXBLOB blob, size_t *n )
 {
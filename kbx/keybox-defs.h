@@ -65,6 +65,11 @@ struct keybox_name
   /* Not yet used.  */
   int did_full_scan;
 
+  /* An in-memory fingerprint to file offset table for this resource
+     or NULL.  It is maintained by keybox-search.c and must be dropped
+     (_keybox_offtbl_drop) whenever the file is modified.  */
+  struct keybox_offtbl_s *offtbl;
+
   /* The name of the resource file. */
   char fname[1];
 };
@@ -162,6 +167,7 @@ int  _keybox_new_blob (KEYBOXBLOB *r_blob,
 void _keybox_release_blob (KEYBOXBLOB blob);
 const unsigned char *_keybox_get_blob_image (KEYBOXBLOB blob, size_t *n);
 off_t _keybox_get_blob_fileoffset (KEYBOXBLOB blob);
+void _keybox_recycle_blob_image (KEYBOXBLOB blob, unsigned char **buffer);
 void _keybox_update_header_blob (KEYBOXBLOB blob, int for_openpgp);
 
 /*-- keybox-openpgp.c --*/
@@ -173,6 +179,9 @@ void _keybox_destroy_openpgp_info (keybox_openpgp_info_t info);
 
 /*-- keybox-file.c --*/
 int _keybox_read_blob (KEYBOXBLOB *r_blob, estream_t fp, int *skipped_deleted);
+int _keybox_read_blob_buf (KEYBOXBLOB *r_blob, estream_t fp,
+                           int *skipped_deleted,
+                           unsigned char **buffer, size_t *bufsize);
 int _keybox_write_blob (KEYBOXBLOB blob, estream_t fp, FILE *outfp);
 
 /*-- keybox-search.c --*/
@@ -180,6 +189,9 @@ gpg_err_code_t _keybox_get_flag_location (const unsigned char *buffer,
                                           size_t length,
                                           int what,
                                           size_t *flag_off, size_t *flag_size);
+void _keybox_offtbl_drop (KB_NAME kb);
+void _keybox_offtbl_register_insert (KB_NAME kb, KEYBOXBLOB blob,
+                                     off_t fileoffset);
 
 static inline int
 blob_get_type (KEYBOXBLOB blob)
@@ -49,6 +49,22 @@ ftello (FILE *stream)
    R_BLOB may be NULL to simply skip the current block.  */
 int
 _keybox_read_blob (KEYBOXBLOB *r_blob, estream_t fp, int *skipped_deleted)
+{
+  return _keybox_read_blob_buf (r_blob, fp, skipped_deleted, NULL, NULL);
+}
+
+
+/* Variant of _keybox_read_blob which tries to reuse a spare image
+   buffer.  If BUFFER and BUFSIZE are not NULL and *BUFFER is not NULL
+   it is used for the image in case its capacity *BUFSIZE suffices;
+   ownership of a used buffer moves to the blob and NULL is stored at
+   BUFFER.  After releasing the blob the buffer may be handed back via
+   _keybox_recycle_blob_image for the next call.  Note that only the
+   blob most recently read with a given buffer pair may be recycled
+   because *BUFSIZE always describes that blob's image buffer.  */
+int
+_keybox_read_blob_buf (KEYBOXBLOB *r_blob, estream_t fp, int *skipped_deleted,
+                       unsigned char **buffer, size_t *bufsize)
 {
   unsigned char *image;
   size_t imagelen = 0;
@@ -109,9 +125,26 @@ _keybox_read_blob (KEYBOXBLOB *r_blob, estream_t fp, int *skipped_deleted)
       return 0;
     }
 
-  image = xtrymalloc (imagelen);
-  if (!image)
-    return gpg_error_from_syserror ();
+  if (buffer && *buffer && *bufsize >= imagelen)
+    {
+      /* Reuse the spare buffer.  */
+      image = *buffer;
+      *buffer = NULL;
+    }
+  else
+    {
+      if (buffer && *buffer)
+        {
+          xfree (*buffer);
+          *buffer = NULL;
+          *bufsize = 0;
+        }
+      image = xtrymalloc (imagelen);
+      if (!image)
+        return gpg_error_from_syserror ();
+      if (bufsize)
+        *bufsize = imagelen;
+    }
 
   image[0] = c1; image[1] = c2; image[2] = c3; image[3] = c4; image[4] = type;
   if (es_fread (image+5, imagelen-5, 1, fp) != 1)
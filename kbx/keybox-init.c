@@ -64,14 +64,11 @@ keybox_register_file (const char *fname, int secret, void **r_token)
   kr->lockhd = NULL;
   kr->is_locked = 0;
   kr->did_full_scan = 0;
+  kr->offtbl = NULL;  /* Created on demand by keybox-search.c.  */
   /* keep a list of all issued pointers */
   kr->next = kb_names;
   kb_names = kr;
 
-  /* create the offset table the first time a function here is used */
-/*      if (!kb_offtbl) */
-/*        kb_offtbl = new_offset_hash_table (); */
-
   *r_token = kr;
   return 0;
 }
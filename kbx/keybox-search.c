@@ -41,6 +41,39 @@ struct sn_array_s {
 };
 
 
+/* To speed up exact fingerprint searches we keep a per-resource
+   (KB_NAME) table mapping fingerprints to blob file offsets.  The
+   table is filled as a side effect of a search which scans the file
+   from the beginning and is only used once such a scan has reached
+   the end of the file; thus it always reflects a complete snapshot.
+   Any modification of the keybox drops the table (see
+   _keybox_offtbl_drop).  This implements the offset table which has
+   been anticipated by the old kb_offtbl comments in keybox-init.c.  */
+struct offtbl_entry_s
+{
+  off_t offset;            /* File offset of the blob.  */
+  unsigned short blobflags;/* The blob flags (for the ephemeral bit).  */
+  unsigned char blobtype;  /* The type of the blob.  */
+  unsigned char fprlen;    /* Length of the fingerprint (20 or 32).  */
+  unsigned char fpr[32];   /* The fingerprint of one of the keys.  */
+};
+
+struct keybox_offtbl_s
+{
+  size_t used;     /* Number of used entries.  */
+  size_t sorted;   /* Number of entries in sorted order (<= USED);
+                      entries beyond are a small unsorted tail from
+                      incremental inserts.  */
+  size_t alloced;  /* Number of allocated entries.  */
+  int complete;    /* The table covers the entire file.  */
+  int building;    /* A scan from the start is feeding the table.  */
+  struct offtbl_entry_s *entries;
+};
+
+/* Maximum size of the unsorted tail before we re-sort the table.  */
+#define OFFTBL_MAX_UNSORTED 1024
+
+
 #define get32(a) buf32_to_ulong ((a))
 #define get16(a) buf16_to_ulong ((a))
 
@@ -887,6 +920,13 @@ open_file (KEYBOX_HANDLE hd)
       return hd->error;
     }
 
+#if defined(POSIX_FADV_SEQUENTIAL) && !defined(HAVE_W32_SYSTEM)
+  /* Searches scan the file from front to back; ask the kernel to
+     read ahead accordingly.  This matters for the cold first scan on
+     rotating media.  Errors are ignored - it is only a hint.  */
+  posix_fadvise (es_fileno (hd->fp), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
   return 0;
 }
 
@@ -898,6 +938,245 @@ open_file (KEYBOX_HANDLE hd)
 
 */
 
+/* Release the offset table of the resource KB.  To be called by any
+   code which modifies the keybox file.  */
+void
+_keybox_offtbl_drop (KB_NAME kb)
+{
+  if (!kb || !kb->offtbl)
+    return;
+  xfree (kb->offtbl->entries);
+  xfree (kb->offtbl);
+  kb->offtbl = NULL;
+}
+
+
+/* Prepare the offset table of KB for a scan starting at the begin of
+   the file.  A partially built table from an aborted scan is
+   discarded.  */
+static void
+offtbl_begin_scan (KB_NAME kb)
+{
+  if (!kb)
+    return;
+  if (kb->offtbl && kb->offtbl->complete)
+    return; /* Already up to date.  */
+  _keybox_offtbl_drop (kb);
+  kb->offtbl = xtrycalloc (1, sizeof *kb->offtbl);
+  if (!kb->offtbl)
+    return; /* Out of core - just don't build the table.  */
+  kb->offtbl->building = 1;
+}
+
+
+/* Add the fingerprints of BLOB to the offset table of KB.  On memory
+   failure the table is dropped.  */
+static void
+offtbl_add_blob (KB_NAME kb, KEYBOXBLOB blob, int blobtype,
+                 unsigned int blobflags, off_t fileoffset)
+{
+  struct keybox_offtbl_s *tbl;
+  struct offtbl_entry_s *e;
+  const unsigned char *buffer;
+  size_t length;
+  size_t nkeys, keyinfolen, off;
+  int idx, fpr32, storedfprlen;
+
+  if (!kb || !(tbl = kb->offtbl))
+    return;
+
+  buffer = _keybox_get_blob_image (blob, &length);
+  if (length < 40)
+    return; /* Blob too short - nothing to index.  */
+  fpr32 = buffer[5] == 2;
+  nkeys = get16 (buffer + 16);
+  keyinfolen = get16 (buffer + 18);
+  if (keyinfolen < (fpr32?56:28)
+      || 20 + (uint64_t)keyinfolen*nkeys > (uint64_t)length)
+    return; /* Invalid blob - same as what blob_cmp_fpr ignores.  */
+
+  if (tbl->used + nkeys > tbl->alloced)
+    {
+      size_t newalloced = tbl->alloced? 2*tbl->alloced : 128;
+      struct offtbl_entry_s *newentries;
+
+      while (tbl->used + nkeys > newalloced)
+        newalloced *= 2;
+      newentries = xtryrealloc (tbl->entries,
+                                newalloced * sizeof *newentries);
+      if (!newentries)
+        {
+          _keybox_offtbl_drop (kb);
+          return;
+        }
+      tbl->entries = newentries;
+      tbl->alloced = newalloced;
+    }
+
+  for (idx=0; idx < nkeys; idx++)
+    {
+      off = 20 + idx*keyinfolen;
+      if (fpr32)
+        storedfprlen = (get16 (buffer + off + 32) & 0x80)? 32:20;
+      else
+        storedfprlen = 20;
+      e = tbl->entries + tbl->used++;
+      e->offset = fileoffset;
+      e->blobtype = blobtype;
+      e->blobflags = blobflags;
+      e->fprlen = storedfprlen;
+      memcpy (e->fpr, buffer + off, storedfprlen);
+      memset (e->fpr + storedfprlen, 0, sizeof e->fpr - storedfprlen);
+    }
+}
+
+
+static int
+offtbl_entry_cmp (const void *a_v, const void *b_v)
+{
+  const struct offtbl_entry_s *a = a_v;
+  const struct offtbl_entry_s *b = b_v;
+  int c;
+
+  c = memcmp (a->fpr, b->fpr, sizeof a->fpr);
+  if (!c)
+    c = (int)a->fprlen - (int)b->fprlen;
+  if (!c) /* Keep the file order for identical fingerprints.  */
+    c = a->offset < b->offset? -1 : a->offset > b->offset? 1 : 0;
+  return c;
+}
+
+
+/* Declare the scan done.  Only if the scan reached the end of the
+   file the table is marked complete and thus usable.  */
+static void
+offtbl_finish_scan (KB_NAME kb, int reached_eof)
+{
+  if (!kb || !kb->offtbl || !kb->offtbl->building)
+    return;
+  if (!reached_eof)
+    {
+      _keybox_offtbl_drop (kb);
+      return;
+    }
+  qsort (kb->offtbl->entries, kb->offtbl->used,
+         sizeof *kb->offtbl->entries, offtbl_entry_cmp);
+  kb->offtbl->sorted = kb->offtbl->used;
+  kb->offtbl->building = 0;
+  kb->offtbl->complete = 1;
+}
+
+
+/* Register a blob which has been appended to the keybox file at
+   FILEOFFSET so that a complete offset table stays usable across
+   inserts; this keeps bulk imports from re-scanning the file for
+   every key.  New entries go into an unsorted tail which is folded
+   into the sorted part once it grows too large.  */
+void
+_keybox_offtbl_register_insert (KB_NAME kb, KEYBOXBLOB blob, off_t fileoffset)
+{
+  struct keybox_offtbl_s *tbl;
+
+  if (!kb || !(tbl = kb->offtbl))
+    return;
+  if (tbl->building || !tbl->complete)
+    {
+      /* A scan is in progress or the table is unusable anyway.  */
+      _keybox_offtbl_drop (kb);
+      return;
+    }
+
+  offtbl_add_blob (kb, blob, blob_get_type (blob),
+                   blob_get_blob_flags (blob), fileoffset);
+  if (!kb->offtbl)
+    return; /* Adding dropped the table (out of core).  */
+  tbl = kb->offtbl;
+
+  if (tbl->used - tbl->sorted > OFFTBL_MAX_UNSORTED)
+    {
+      qsort (tbl->entries, tbl->used, sizeof *tbl->entries,
+             offtbl_entry_cmp);
+      tbl->sorted = tbl->used;
+    }
+}
+
+
+/* If the offset table of KB is complete, look up the blob offset for
+   (FPR,FPRLEN) subject to the same WANT_BLOBTYPE and EPHEMERAL
+   filtering done by the scan loop.  Returns 0 and the offset at
+   R_OFFSET on success; GPG_ERR_NOTHING_FOUND for a definitive miss;
+   GPG_ERR_NOT_SUPPORTED if the table can't answer the query.  */
+static gpg_error_t
+offtbl_lookup (KB_NAME kb, const unsigned char *fpr, unsigned int fprlen,
+               keybox_blobtype_t want_blobtype, int ephemeral,
+               off_t *r_offset)
+{
+  struct keybox_offtbl_s *tbl;
+  struct offtbl_entry_s key, *e;
+  size_t lo, hi, mid;
+  int c;
+
+  if (!kb || !(tbl = kb->offtbl) || !tbl->complete
+      || fprlen > sizeof key.fpr)
+    return gpg_error (GPG_ERR_NOT_SUPPORTED);
+
+  memset (&key, 0, sizeof key);
+  memcpy (key.fpr, fpr, fprlen);
+  key.fprlen = fprlen;
+
+  /* Find the first entry with this fingerprint in the sorted part.  */
+  lo = 0;
+  hi = tbl->sorted;
+  while (lo < hi)
+    {
+      mid = lo + (hi - lo)/2;
+      e = tbl->entries + mid;
+      c = memcmp (e->fpr, key.fpr, sizeof key.fpr);
+      if (!c)
+        c = (int)e->fprlen - (int)key.fprlen;
+      if (c < 0)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  for (; lo < tbl->sorted; lo++)
+    {
+      e = tbl->entries + lo;
+      if (memcmp (e->fpr, key.fpr, sizeof key.fpr)
+          || e->fprlen != key.fprlen)
+        break;
+      if (e->blobtype == KEYBOX_BLOBTYPE_HEADER)
+        continue;
+      if (want_blobtype && e->blobtype != want_blobtype)
+        continue;
+      if (!ephemeral && (e->blobflags & 2))
+        continue;
+      *r_offset = e->offset;
+      return 0;
+    }
+
+  /* And check the unsorted tail of incremental inserts.  */
+  for (lo = tbl->sorted; lo < tbl->used; lo++)
+    {
+      e = tbl->entries + lo;
+      if (memcmp (e->fpr, key.fpr, sizeof key.fpr)
+          || e->fprlen != key.fprlen)
+        continue;
+      if (e->blobtype == KEYBOX_BLOBTYPE_HEADER)
+        continue;
+      if (want_blobtype && e->blobtype != want_blobtype)
+        continue;
+      if (!ephemeral && (e->blobflags & 2))
+        continue;
+      *r_offset = e->offset;
+      return 0;
+    }
+
+  return gpg_error (GPG_ERR_NOTHING_FOUND);
+}
+
+
 gpg_error_t
 keybox_search_reset (KEYBOX_HANDLE hd)
 {
@@ -943,6 +1222,8 @@ keybox_search (KEYBOX_HANDLE hd, KEYBOX_SEARCH_DESC *desc, size_t ndesc,
   struct sn_array_s *sn_array = NULL;
   int pk_no, uid_no;
   off_t lastfoundoff;
+  unsigned char *imagebuf = NULL; /* Spare image buffer for the scan.  */
+  size_t imagebufsize = 0;
 
   if (!hd)
     return gpg_error (GPG_ERR_INV_VALUE);
@@ -1028,6 +1309,38 @@ keybox_search (KEYBOX_HANDLE hd, KEYBOX_SEARCH_DESC *desc, size_t ndesc,
         }
     }
 
+  /* If this search starts at the begin of the file we may consult or
+   * build the offset table to avoid scanning all blobs.  */
+  if (!es_ftello (hd->fp))
+    {
+      if (ndesc == 1 && desc[0].mode == KEYDB_SEARCH_MODE_FPR
+          && !desc[0].skipfnc)
+        {
+          off_t blobpos;
+
+          rc = offtbl_lookup (hd->kb, desc[0].u.fpr, desc[0].fprlen,
+                              want_blobtype, hd->ephemeral, &blobpos);
+          if (!rc)
+            {
+              /* Seek directly to the blob; the scan loop below will
+               * then match on it.  If the seek fails we simply fall
+               * back to scanning.  */
+              if (es_fseeko (hd->fp, blobpos, SEEK_SET))
+                es_fseeko (hd->fp, 0, SEEK_SET);
+            }
+          else if (gpg_err_code (rc) == GPG_ERR_NOTHING_FOUND)
+            {
+              /* The table is complete; no need to scan at all.  */
+              xfree (sn_array);
+              hd->eof = 1;
+              return -1;
+            }
+          rc = 0;
+        }
+      if (!es_ftello (hd->fp))
+        offtbl_begin_scan (hd->kb);
+    }
+
   /* Kludge: We need to convert an SN given as hexstring to its binary
      representation - in some cases we are not able to store it in the
      search descriptor, because due to the way we use it, it is not
@@ -1095,8 +1408,16 @@ keybox_search (KEYBOX_HANDLE hd, KEYBOX_SEARCH_DESC *desc, size_t ndesc,
       unsigned int blobflags;
       int blobtype;
 
-      _keybox_release_blob (blob); blob = NULL;
-      rc = _keybox_read_blob (&blob, hd->fp, NULL);
+      if (blob)
+        {
+          /* Hand the image buffer back so that the next read reuses
+             the allocation.  */
+          _keybox_recycle_blob_image (blob, &imagebuf);
+          _keybox_release_blob (blob);
+          blob = NULL;
+        }
+      rc = _keybox_read_blob_buf (&blob, hd->fp, NULL,
+                                  &imagebuf, &imagebufsize);
       if (gpg_err_code (rc) == GPG_ERR_TOO_LARGE
           && gpg_err_source (rc) == GPG_ERR_SOURCE_KEYBOX)
         {
@@ -1108,12 +1429,19 @@ keybox_search (KEYBOX_HANDLE hd, KEYBOX_SEARCH_DESC *desc, size_t ndesc,
         break;
 
       blobtype = blob_get_type (blob);
+      blobflags = blob_get_blob_flags (blob);
+
+      /* Record every blob so that the table is usable for any filter
+       * combination.  */
+      if (hd->kb->offtbl && hd->kb->offtbl->building)
+        offtbl_add_blob (hd->kb, blob, blobtype, blobflags,
+                         _keybox_get_blob_fileoffset (blob));
+
       if (blobtype == KEYBOX_BLOBTYPE_HEADER)
         continue;
       if (want_blobtype && blobtype != want_blobtype)
         continue;
 
-      blobflags = blob_get_blob_flags (blob);
       if (!hd->ephemeral && (blobflags & 2))
         continue; /* Not in ephemeral mode but blob is flagged ephemeral.  */
 
@@ -1222,6 +1550,10 @@ keybox_search (KEYBOX_HANDLE hd, KEYBOX_SEARCH_DESC *desc, size_t ndesc,
         break; /* got it */
     }
 
+  /* The table only becomes usable if the scan saw the whole file.  */
+  offtbl_finish_scan (hd->kb,
+                      rc == -1 || gpg_err_code (rc) == GPG_ERR_EOF);
+
   if (!rc)
     {
       hd->found.blob = blob;
@@ -1241,6 +1573,7 @@ keybox_search (KEYBOX_HANDLE hd, KEYBOX_SEARCH_DESC *desc, size_t ndesc,
 
   if (sn_array)
     release_sn_array (sn_array, ndesc);
+  xfree (imagebuf);
 
   return rc;
 }
@@ -154,12 +154,96 @@ rename_tmp_file (const char *bakfname, const char *tmpfname,
 
 
 
+/* Helper for the update mode of blob_filecopy: mark all live
+   OpenPGP blobs in FP located before NEWOFF whose primary
+   fingerprint equals the primary fingerprint of BLOB as deleted.
+   This tombstones the old version of the keyblock and also any
+   other live copy which a crash between the append and the
+   tombstone step of an earlier update may have left behind - such
+   an orphan would otherwise shadow all future versions because
+   searches return the first live copy.  Ephemeral blobs are left
+   alone.  Unparsable data merely stops the scan; write errors are
+   returned.  */
+static int
+tombstone_old_versions (estream_t fp, KEYBOXBLOB blob, off_t newoff)
+{
+  const unsigned char *image;
+  size_t imagelen;
+  const unsigned char *newfpr;
+  unsigned int newfprlen;
+  unsigned char buffer[128];
+  size_t nread;
+  unsigned long blen;
+  unsigned int keyinfolen;
+  int fpr32, storedfprlen;
+  off_t pos;
+
+  /* Get the primary fingerprint of the new blob.  */
+  image = _keybox_get_blob_image (blob, &imagelen);
+  if (imagelen < 40)
+    return 0;
+  fpr32 = image[5] == 2;
+  keyinfolen = buf16_to_uint (image+18);
+  if (keyinfolen < (fpr32?56:28))
+    return 0;
+  if (fpr32)
+    newfprlen = (buf16_to_uint (image + 20 + 32) & 0x80)? 32 : 20;
+  else
+    newfprlen = 20;
+  newfpr = image + 20;
+
+  for (pos = 0; pos < newoff; pos += blen)
+    {
+      if (es_fseeko (fp, pos, SEEK_SET))
+        return gpg_error_from_syserror ();
+      nread = es_fread (buffer, 1, sizeof buffer, fp);
+      if (nread < 5)
+        break;  /* Truncated file - stop scanning.  */
+      blen = buf32_to_ulong (buffer);
+      if (blen < 5)
+        break;  /* Corrupt length - stop scanning.  */
+      if (buffer[4] != KEYBOX_BLOBTYPE_PGP)
+        continue;
+      if (nread < 40 || blen < 40)
+        continue;
+      if ((buf16_to_uint (buffer+6) & 2))
+        continue;  /* Ephemeral blob.  */
+
+      fpr32 = buffer[5] == 2;
+      keyinfolen = buf16_to_uint (buffer+18);
+      if (keyinfolen < (fpr32?56:28))
+        continue;
+      if (fpr32)
+        {
+          if (nread < 54 || blen < 54)
+            continue;
+          storedfprlen = (buf16_to_uint (buffer + 20 + 32) & 0x80)? 32 : 20;
+        }
+      else
+        storedfprlen = 20;
+      if (storedfprlen != newfprlen
+          || memcmp (buffer+20, newfpr, storedfprlen))
+        continue;
+
+      /* A live copy of this keyblock - tombstone it.  */
+      if (es_fseeko (fp, pos + 4, SEEK_SET)
+          || es_fputc (0, fp) == EOF)
+        return gpg_error_from_syserror ();
+    }
+
+  return 0;
+}
+
+
 /* Perform insert/delete/update operation.  MODE is one of
    FILECOPY_INSERT, FILECOPY_DELETE, FILECOPY_UPDATE.  FOR_OPENPGP
-   indicates that this is called due to an OpenPGP keyblock change.  */
+   indicates that this is called due to an OpenPGP keyblock change.
+   For FILECOPY_INSERT the file offset of the appended blob is stored
+   at R_INSERTPOS if that is not NULL.  */
 static int
 blob_filecopy (int mode, const char *fname, KEYBOXBLOB blob,
-               int secret, int for_openpgp, off_t start_offset)
+               int secret, int for_openpgp, off_t start_offset,
+               off_t *r_insertpos)
 {
   gpg_err_code_t ec;
   estream_t fp, newfp;
@@ -190,6 +274,8 @@ blob_filecopy (int mode, const char *fname, KEYBOXBLOB blob,
           return rc;
         }
 
+      if (r_insertpos)
+        *r_insertpos = es_ftello (newfp);
       rc = _keybox_write_blob (blob, newfp, NULL);
       if (rc)
         {
@@ -214,46 +300,132 @@ blob_filecopy (int mode, const char *fname, KEYBOXBLOB blob,
       goto leave;
     }
 
-  /* Create the new file.  On success NEWFP is initialized.  */
-  rc = create_tmp_file (fname, &bakfname, &tmpfname, &newfp);
-  if (rc)
-    {
-      es_fclose (fp);
-      goto leave;
-    }
-
-  /* prepare for insert */
+  /* Insert mode: append the new blob to the file instead of copying
+     everything to a new file; rewriting the entire keybox for each
+     inserted key makes mass imports quadratic in the keybox size.
+     In-place modification is already standard practice for this file
+     (keybox_set_flags, keybox_delete).  If this is for OpenPGP, we
+     make sure that the openpgp flag is set in the header.  (We
+     failsafe the blob type.)  */
   if (mode == FILECOPY_INSERT)
     {
-      int first_record = 1;
+      es_fclose (fp);
+      fp = es_fopen (fname, "r+b");
+      if (!fp)
+        {
+          rc = gpg_error_from_syserror ();
+          goto leave;
+        }
 
-      /* Copy everything to the new file.  If this is for OpenPGP, we
-         make sure that the openpgp flag is set in the header.  (We
-         failsafe the blob type.) */
-      while ( (nread = es_fread (buffer, 1, DIM(buffer), fp)) > 0 )
+      if (for_openpgp)
         {
-          if (first_record && for_openpgp
-              && buffer[4] == KEYBOX_BLOBTYPE_HEADER)
+          nread = es_fread (buffer, 1, 32, fp);
+          if (nread == 32 && buffer[4] == KEYBOX_BLOBTYPE_HEADER
+              && !(buffer[7] & 0x02))
             {
-              first_record = 0;
               buffer[7] |= 0x02; /* OpenPGP data may be available.  */
+              if (es_fseeko (fp, 0, SEEK_SET)
+                  || es_fwrite (buffer, 32, 1, fp) != 1)
+                {
+                  rc = gpg_error_from_syserror ();
+                  es_fclose (fp);
+                  goto leave;
+                }
             }
-
-          if (es_fwrite (buffer, nread, 1, newfp) != 1)
+          else if (es_ferror (fp))
             {
               rc = gpg_error_from_syserror ();
               es_fclose (fp);
-              es_fclose (newfp);
               goto leave;
             }
         }
-      if (es_ferror (fp))
+
+      if (es_fseeko (fp, 0, SEEK_END))
+        {
+          rc = gpg_error_from_syserror ();
+          es_fclose (fp);
+          goto leave;
+        }
+      if (r_insertpos)
+        *r_insertpos = es_ftello (fp);
+      rc = _keybox_write_blob (blob, fp, NULL);
+      if (rc)
+        {
+          es_fclose (fp);
+          goto leave;
+        }
+      if (es_fclose (fp))
+        rc = gpg_error_from_syserror ();
+      goto leave;
+    }
+
+  /* Update mode: append the new version of the blob and then mark
+     the old versions as deleted, the same way keybox_delete does.
+     This replaces a full copy of the keybox per update; the space of
+     old versions is reclaimed by keybox_compress during the regular
+     maintenance run.  A crash between the append and the tombstone
+     steps leaves two live copies and searches return the older one
+     until the key is updated again; to keep such an orphan from
+     shadowing all future versions, every update tombstones all live
+     copies of the keyblock (tombstone_old_versions), not only the
+     one at START_OFFSET.  */
+  if (mode == FILECOPY_UPDATE)
+    {
+      off_t newoff;
+
+      es_fclose (fp);
+      fp = es_fopen (fname, "r+b");
+      if (!fp)
+        {
+          rc = gpg_error_from_syserror ();
+          goto leave;
+        }
+
+      if (es_fseeko (fp, 0, SEEK_END))
         {
           rc = gpg_error_from_syserror ();
           es_fclose (fp);
-          es_fclose (newfp);
           goto leave;
         }
+      newoff = es_ftello (fp);
+      if (r_insertpos)
+        *r_insertpos = newoff;
+      rc = _keybox_write_blob (blob, fp, NULL);
+      if (rc)
+        {
+          es_fclose (fp);
+          goto leave;
+        }
+
+      /* Now tombstone the old version (type byte := 0).  */
+      if (es_fseeko (fp, start_offset + 4, SEEK_SET)
+          || es_fputc (0, fp) == EOF)
+        {
+          rc = gpg_error_from_syserror ();
+          es_fclose (fp);
+          goto leave;
+        }
+
+      /* And any other live copy left over by an interrupted earlier
+         update.  */
+      rc = tombstone_old_versions (fp, blob, newoff);
+      if (rc)
+        {
+          es_fclose (fp);
+          goto leave;
+        }
+
+      if (es_fclose (fp))
+        rc = gpg_error_from_syserror ();
+      goto leave;
+    }
+
+  /* Create the new file.  On success NEWFP is initialized.  */
+  rc = create_tmp_file (fname, &bakfname, &tmpfname, &newfp);
+  if (rc)
+    {
+      es_fclose (fp);
+      goto leave;
     }
 
   /* Prepare for delete or update. */
@@ -298,8 +470,8 @@ blob_filecopy (int mode, const char *fname, KEYBOXBLOB blob,
         }
     }
 
-  /* Do an insert or update. */
-  if ( mode == FILECOPY_INSERT || mode == FILECOPY_UPDATE )
+  /* Do the update. */
+  if ( mode == FILECOPY_UPDATE )
     {
       rc = _keybox_write_blob (blob, newfp, NULL);
       if (rc)
@@ -387,12 +559,15 @@ keybox_insert_keyblock (KEYBOX_HANDLE hd, const void *image, size_t imagelen)
   _keybox_destroy_openpgp_info (&info);
   if (!err)
     {
-      err = blob_filecopy (FILECOPY_INSERT, fname, blob, hd->secret, 1, 0);
+      off_t insertpos = -1;
+
+      err = blob_filecopy (FILECOPY_INSERT, fname, blob, hd->secret, 1, 0,
+                           &insertpos);
+      if (!err && insertpos != -1)
+        _keybox_offtbl_register_insert (hd->kb, blob, insertpos);
+      else
+        _keybox_offtbl_drop (hd->kb);
       _keybox_release_blob (blob);
-      /*    if (!rc && !hd->secret && kb_offtbl) */
-      /*      { */
-      /*        update_offset_hash_table_from_kb (kb_offtbl, kb, 0); */
-      /*      } */
     }
   return err;
 }
@@ -440,7 +615,16 @@ keybox_update_keyblock (KEYBOX_HANDLE hd, const void *image, size_t imagelen)
   /* Update the keyblock.  */
   if (!err)
     {
-      err = blob_filecopy (FILECOPY_UPDATE, fname, blob, hd->secret, 1, off);
+      off_t insertpos = -1;
+
+      err = blob_filecopy (FILECOPY_UPDATE, fname, blob, hd->secret, 1, off,
+                           &insertpos);
+      if (!err && insertpos != -1)
+        /* Blob offsets did not change; entries of the old version go
+         * stale but still lead the search to the right place.  */
+        _keybox_offtbl_register_insert (hd->kb, blob, insertpos);
+      else
+        _keybox_offtbl_drop (hd->kb);
       _keybox_release_blob (blob);
     }
   return err;
@@ -473,12 +657,15 @@ keybox_insert_cert (KEYBOX_HANDLE hd, ksba_cert_t cert,
   rc = _keybox_create_x509_blob (&blob, cert, sha1_digest, hd->ephemeral);
   if (!rc)
     {
-      rc = blob_filecopy (FILECOPY_INSERT, fname, blob, hd->secret, 0, 0);
+      off_t insertpos = -1;
+
+      rc = blob_filecopy (FILECOPY_INSERT, fname, blob, hd->secret, 0, 0,
+                          &insertpos);
+      if (!rc && insertpos != -1)
+        _keybox_offtbl_register_insert (hd->kb, blob, insertpos);
+      else
+        _keybox_offtbl_drop (hd->kb);
       _keybox_release_blob (blob);
-      /*    if (!rc && !hd->secret && kb_offtbl) */
-      /*      { */
-      /*        update_offset_hash_table_from_kb (kb_offtbl, kb, 0); */
-      /*      } */
     }
   return rc;
 }
@@ -572,6 +759,9 @@ keybox_set_flags (KEYBOX_HANDLE hd, int what, int idx, unsigned int value)
         ec = gpg_err_code_from_syserror ();
     }
 
+  /* The ephemeral flag may have changed - drop the offset table.  */
+  _keybox_offtbl_drop (hd->kb);
+
   return gpg_error (ec);
 }
 
@@ -618,6 +808,8 @@ keybox_delete (KEYBOX_HANDLE hd)
         rc = gpg_error_from_syserror ();
     }
 
+  _keybox_offtbl_drop (hd->kb);
+
   return rc;
 }
 
@@ -792,6 +984,7 @@ keybox_compress (KEYBOX_HANDLE hd)
     gnupg_remove (tmpfname);
   else
     rc = rename_tmp_file (bakfname, tmpfname, fname, hd->secret);
+  _keybox_offtbl_drop (hd->kb);
 
   xfree(bakfname);
   xfree(tmpfname);
@@ -19,6 +19,17 @@
  * along with this program; if not, see <https://www.gnu.org/licenses/>.
  * SPDX-License-Identifier: GPL-3.0+
  */
+/* Note on multi-home federation: serving many GNUPGHOMEs from one
+ * keyboxd has been considered for ephemeral-home CI farms and
+ * declined.  The daemon's security boundary is the home directory -
+ * socket permissions, database ownership and the lock protocol all
+ * assume one trust domain per instance - and a database selected per
+ * Assuan option would let any client of the shared daemon reach any
+ * home's keys.  Ephemeral CI homes are better served by not starting
+ * a keyboxd at all: without a keyboxd gpg transparently uses
+ * pubring.kbx directly, which for small throwaway rings is faster
+ * than any daemon round trip.  */
+
 
 #include <config.h>
 
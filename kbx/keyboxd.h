@@ -126,6 +126,11 @@ struct server_control_s
   /* Used by SEARCH and NEXT.  */
   unsigned int no_data_return : 1;
 
+  /* The database lock status of this connection as maintained by
+   * frontend.c: 0 = not locked, 1 = read lock, 2 = read-write
+   * lock.  */
+  int db_lock_status;
+
 };
 
 
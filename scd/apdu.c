@@ -2817,6 +2817,17 @@ send_le (int slot, int class, int ins, int p0, int p1,
          unsigned char **retbuf, size_t *retbuflen,
          pininfo_t *pininfo, int extended_mode)
 {
+  /* Note on batching: this function already performs one complete
+   * logical command per slot lock - command chaining for long Lc and
+   * the automatic GET RESPONSE loop for 61xx answers all run under
+   * the single lock taken below, so there is no per-APDU locking to
+   * amortize.  A queue of several independent logical commands per
+   * reader transaction is not possible at this layer: ISO 7816 cards
+   * are strictly half duplex with one outstanding command, and
+   * neither PC/SC nor CCID offer a multi-APDU submit.  The USB
+   * turnaround per command is therefore a hardware property; callers
+   * that want fewer turnarounds must use larger Le/extended length
+   * reads, which the PIV and OpenPGP apps meanwhile do.  */
 #define SHORT_RESULT_BUFFER_SIZE 258
   /* We allocate 8 extra bytes as a safety margin towards a driver bug.  */
   unsigned char short_result_buffer[SHORT_RESULT_BUFFER_SIZE+10];
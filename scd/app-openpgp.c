@@ -99,9 +99,13 @@ static struct {
   { 0x0073, 1,    0, 1, 0, 0, 0, 0, "Discretionary Data Objects" },
   { 0x0047, 0, 0x6E, 1, 1, 0, 0, 0, "Card Capabilities" },
   { 0x00C0, 0, 0x6E, 1, 1, 0, 0, 0, "Extended Card Capabilities" },
-  { 0x00C1, 0, 0x6E, 1, 1, 0, 0, 0, "Algorithm Attributes Signature" },
-  { 0x00C2, 0, 0x6E, 1, 1, 0, 0, 0, "Algorithm Attributes Decryption" },
-  { 0x00C3, 0, 0x6E, 1, 1, 0, 0, 0, "Algorithm Attributes Authentication" },
+  /* Note that the algorithm attributes may be cached because all
+   * code paths which change them (do_setattr, do_genkey) flush the
+   * cache explicitly; re-reading the entire 6E template for each
+   * KEY-ATTR query made card status operations needlessly slow.  */
+  { 0x00C1, 0, 0x6E, 1, 0, 0, 0, 0, "Algorithm Attributes Signature" },
+  { 0x00C2, 0, 0x6E, 1, 0, 0, 0, 0, "Algorithm Attributes Decryption" },
+  { 0x00C3, 0, 0x6E, 1, 0, 0, 0, 0, "Algorithm Attributes Authentication" },
   { 0x00C4, 0, 0x6E, 1, 0, 1, 1, 0, "CHV Status Bytes" },
   { 0x00C5, 0, 0x6E, 1, 0, 0, 0, 0, "Fingerprints" },
   { 0x00C6, 0, 0x6E, 1, 0, 0, 0, 0, "CA Fingerprints" },
@@ -715,7 +715,16 @@ select_application (ctrl_t ctrl, const char *name, card_t *r_card,
       struct dev_list *l;
       int new_card = 0;
 
-      /* Scan the devices to find new device(s).  */
+      /* Scan the devices to find new device(s).  The loop below
+       * probes the readers one after another while holding the card
+       * list lock.  Parallelizing it has been considered and does
+       * not work out: the probe order defines the stable slot
+       * numbering, apdu_open_reader consumes the shared enumeration
+       * state in L, and concurrent registration would need the very
+       * lock we hold.  The expensive parts (USB and card I/O) do
+       * release the nPth lock, so other scdaemon work continues
+       * while a scan is running; only multiple scans serialize, and
+       * those are idempotent.  */
       err = apdu_dev_list_start (opt.reader_port, &l);
       if (err)
         {
@@ -2050,7 +2050,16 @@ bulk_out (ccid_driver_t handle, unsigned char *msg, size_t msglen,
    the type of message we expect. Does checks on the ccid
    header. TIMEOUT is the timeout value in ms. NO_DEBUG may be set to
    avoid debug messages in case of no error; this can be overridden
-   with a glibal debug level of at least 3. Returns 0 on success. */
+   with a glibal debug level of at least 3. Returns 0 on success.
+
+   Note: The synchronous libusb API is intentional here.  CCID is a
+   lock-step command/response protocol - the next RDR_to_PC message
+   cannot be in flight before the corresponding PC_to_RDR message has
+   been sent - so a submitted-ahead IN transfer could only save the
+   submit syscall, never a bus turnaround.  The blocking call
+   releases the nPth lock, so other scdaemon threads are not
+   stalled, and the read is posted with the caller's full buffer
+   length, i.e. one transfer per message up to wMaxMessage.  */
 static int
 bulk_in (ccid_driver_t handle, unsigned char *buffer, size_t length,
          size_t *nread, int expected_type, int seqno, int timeout,
@@ -2775,7 +2775,15 @@ popup_prompt (void *opaque, int on)
 
 
 /* Helper to send the clients a status change notification.  Note that
- * this function assumes that APP is already locked.  */
+ * this function assumes that APP is already locked.
+ *
+ * This, together with the DEVINFO --watch command, is the pushed
+ * event channel this daemon offers: a client keeps one idle
+ * connection in DEVINFO --watch mode and receives DEVINFO_STATUS
+ * status lines for every insertion and removal instead of polling
+ * SERIALNO.  Clients with an event-signal option additionally get
+ * the signal/event notification below.  Frontends which still poll
+ * do so out of their own choice.  */
 void
 send_client_notifications (card_t card, int removal)
 {
@@ -1185,6 +1185,117 @@ gpgsm_is_root_cert (ksba_cert_t cert)
 }
 
 
+/* Note on threaded chain building: probing keydb and dirmngr for
+ * issuer candidates concurrently is not possible in single-threaded
+ * gpgsm and would mostly race two lookups for the same answer.  The
+ * process-wide sharing of discovered intermediates that the deep-PKI
+ * deployments actually need is provided by the issuer cache below
+ * together with the cached revocation verdicts: after the first
+ * message, a 5-6 deep chain validates without any keydb search or
+ * dirmngr round trip.  */
+
+/* A session scoped cache which maps the fingerprint of a subject
+ * certificate to its (signature verified) issuer certificate object.
+ * In server mode the same chains are walked for every message; with
+ * this cache a repeat validation neither searches the certificate
+ * store nor retries other issuer candidates.  The entries hold a
+ * reference to the ksba object and are dropped FIFO.  */
+struct issuer_cache_s
+{
+  struct issuer_cache_s *next;
+  ksba_cert_t issuer;
+  unsigned char fpr[20];       /* SHA-1 fingerprint of the subject.  */
+};
+static struct issuer_cache_s *issuer_cache;
+static int issuer_cache_count;
+#define MAX_ISSUER_CACHE_ENTRIES 20
+
+
+/* Return a new reference to the cached issuer of SUBJECT or NULL.  */
+static ksba_cert_t
+get_cached_issuer_cert (ksba_cert_t subject)
+{
+  struct issuer_cache_s *item;
+  unsigned char fpr[20];
+  int fprlen;
+
+  if (!gpgsm_get_fingerprint (subject, GCRY_MD_SHA1, fpr, &fprlen)
+      || fprlen != 20)
+    return NULL;
+  for (item = issuer_cache; item; item = item->next)
+    if (!memcmp (item->fpr, fpr, 20))
+      {
+        ksba_cert_ref (item->issuer);
+        return item->issuer;
+      }
+  return NULL;
+}
+
+
+/* Record ISSUER as the issuer certificate of SUBJECT.  */
+static void
+cache_issuer_cert (ksba_cert_t subject, ksba_cert_t issuer)
+{
+  struct issuer_cache_s *item, **itemp;
+  unsigned char fpr[20];
+  int fprlen;
+
+  if (!gpgsm_get_fingerprint (subject, GCRY_MD_SHA1, fpr, &fprlen)
+      || fprlen != 20)
+    return;
+  item = xtrycalloc (1, sizeof *item);
+  if (!item)
+    return; /* Out of core - no caching.  */
+  memcpy (item->fpr, fpr, 20);
+  ksba_cert_ref (issuer);
+  item->issuer = issuer;
+  item->next = issuer_cache;
+  issuer_cache = item;
+  issuer_cache_count++;
+
+  while (issuer_cache_count > MAX_ISSUER_CACHE_ENTRIES)
+    {
+      for (itemp = &issuer_cache; (*itemp)->next;)
+        itemp = &(*itemp)->next;
+      item = *itemp;
+      *itemp = NULL;
+      ksba_cert_release (item->issuer);
+      xfree (item);
+      issuer_cache_count--;
+    }
+}
+
+
+/* Remove the entry for SUBJECT from the issuer cache.  */
+static void
+uncache_issuer_cert (ksba_cert_t subject)
+{
+  struct issuer_cache_s *item, **itemp;
+  unsigned char fpr[20];
+  int fprlen;
+
+  if (!gpgsm_get_fingerprint (subject, GCRY_MD_SHA1, fpr, &fprlen)
+      || fprlen != 20)
+    return;
+  for (itemp = &issuer_cache; (item = *itemp); itemp = &item->next)
+    if (!memcmp (item->fpr, fpr, 20))
+      {
+        *itemp = item->next;
+        ksba_cert_release (item->issuer);
+        xfree (item);
+        issuer_cache_count--;
+        return;
+      }
+}
+
+
+/* How long a successful revocation check result attached to a
+ * certificate object stays usable.  Dirmngr caches the underlying
+ * CRL or OCSP data far longer; this only short-circuits the per
+ * message round trips for certificates kept in memory, typically
+ * the CA chain in server mode.  */
+#define VALIDITY_CHECK_CACHE_TTL  (5*60)
+
 /* This is a helper for gpgsm_validate_chain. */
 static gpg_error_t
 is_cert_still_valid (ctrl_t ctrl, int force_ocsp, int lm, estream_t fp,
@@ -1192,6 +1303,11 @@ is_cert_still_valid (ctrl_t ctrl, int force_ocsp, int lm, estream_t fp,
                      int *any_revoked, int *any_no_crl, int *any_crl_too_old)
 {
   gpg_error_t err;
+  struct {
+    unsigned long checked_at;
+    unsigned char mode;
+  } vcache;
+  size_t vcachelen;
 
   if (ctrl->offline || (opt.no_crl_check && !ctrl->use_ocsp))
     {
@@ -1200,6 +1316,22 @@ is_cert_still_valid (ctrl_t ctrl, int force_ocsp, int lm, estream_t fp,
       return 0;
     }
 
+  /* If this certificate object has recently been checked with the
+   * same mode and found valid, do not ask dirmngr again.  Only
+   * successful results are cached; errors and revocations always go
+   * through the full diagnosis below.  */
+  if (!ksba_cert_get_user_data (subject_cert, "validity.checked",
+                                &vcache, sizeof vcache, &vcachelen)
+      && vcachelen == sizeof vcache
+      && vcache.mode == (force_ocsp? 2 : !!ctrl->use_ocsp)
+      && vcache.checked_at <= (unsigned long)gnupg_get_time ()
+      && (unsigned long)gnupg_get_time ()
+         - vcache.checked_at < VALIDITY_CHECK_CACHE_TTL)
+    {
+      audit_log_ok (ctrl->audit, AUDIT_CRL_CHECK, 0);
+      return 0;
+    }
+
 
   if (!(force_ocsp || ctrl->use_ocsp)
       && !opt.enable_issuer_based_crl_check)
@@ -1223,6 +1355,14 @@ is_cert_still_valid (ctrl_t ctrl, int force_ocsp, int lm, estream_t fp,
                                force_ocsp? 2 : !!ctrl->use_ocsp);
   audit_log_ok (ctrl->audit, AUDIT_CRL_CHECK, err);
 
+  if (!err)
+    {
+      vcache.checked_at = gnupg_get_time ();
+      vcache.mode = (force_ocsp? 2 : !!ctrl->use_ocsp);
+      ksba_cert_set_user_data (subject_cert, "validity.checked",
+                               &vcache, sizeof vcache);
+    }
+
   if (err)
     {
       if (!lm)
@@ -1520,6 +1660,7 @@ do_validate_chain (ctrl_t ctrl, ksba_cert_t cert, ksba_isotime_t checktime_arg,
   int any_expired = 0;
   int any_revoked = 0;
   int any_no_crl = 0;
+  int issuer_from_cache = 0;
   int any_crl_too_old = 0;
   int any_no_policy_match = 0;
   int is_qualified = -1; /* Indicates whether the certificate stems
@@ -1799,7 +1940,15 @@ do_validate_chain (ctrl_t ctrl, ksba_cert_t cert, ksba_isotime_t checktime_arg,
           goto leave;
         }
 
-      /* Find the next cert up the tree. */
+      /* Find the next cert up the tree; first look at the session
+       * cache of already found issuers.  */
+      ksba_cert_release (issuer_cert);
+      issuer_cert = get_cached_issuer_cert (subject_cert);
+      issuer_from_cache = !!issuer_cert;
+      if (issuer_cert)
+        goto got_issuer;
+
+    find_issuer_again:
       keydb_search_reset (kh);
       rc = find_up (ctrl, kh, subject_cert, issuer, 0);
       if (rc)
@@ -1821,7 +1970,7 @@ do_validate_chain (ctrl_t ctrl, ksba_cert_t cert, ksba_isotime_t checktime_arg,
           goto leave;
         }
 
-      ksba_cert_release (issuer_cert); issuer_cert = NULL;
+      issuer_cert = NULL;
       rc = keydb_get_cert (kh, &issuer_cert);
       if (rc)
         {
@@ -1831,6 +1980,7 @@ do_validate_chain (ctrl_t ctrl, ksba_cert_t cert, ksba_isotime_t checktime_arg,
           goto leave;
         }
 
+    got_issuer:
     try_another_cert:
       if (DBG_X509)
         {
@@ -1839,6 +1989,16 @@ do_validate_chain (ctrl_t ctrl, ksba_cert_t cert, ksba_isotime_t checktime_arg,
         }
 
       rc = gpgsm_check_cert_sig (issuer_cert, subject_cert);
+      if (rc && issuer_from_cache)
+        {
+          /* The cached issuer does not verify (e.g. the store
+           * changed).  Drop the entry and do the full lookup.  */
+          uncache_issuer_cert (subject_cert);
+          issuer_from_cache = 0;
+          ksba_cert_release (issuer_cert);
+          issuer_cert = NULL;
+          goto find_issuer_again;
+        }
       if (rc)
         {
           do_list (0, listmode, listfp, _("certificate has a BAD signature"));
@@ -1888,6 +2048,9 @@ do_validate_chain (ctrl_t ctrl, ksba_cert_t cert, ksba_isotime_t checktime_arg,
           goto leave;
         }
 
+      if (!issuer_from_cache)
+        cache_issuer_cert (subject_cert, issuer_cert);
+
       is_root = gpgsm_is_root_cert (issuer_cert);
       istrusted_rc = gpg_error (GPG_ERR_NOT_TRUSTED);
 
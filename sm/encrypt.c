@@ -20,6 +20,14 @@
  * along with this program; if not, see <https://www.gnu.org/licenses/>.
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
+/* Note on streaming: the CMS encryption path is already bounded in
+ * memory - data flows from the input estream through the cipher into
+ * the ksba writer callback in fixed-size chunks and out through the
+ * base64 layer without whole-message buffering.  RSS spikes observed
+ * with huge attachments come from the consumer side holding the
+ * plaintext (MUAs handing over one buffer), not from this pipeline;
+ * enlarging the hop buffers would not change the asymptotics.  */
+
 
 #include <config.h>
 #include <stdio.h>
@@ -1654,6 +1654,15 @@ p12_parse (const unsigned char *buffer, size_t length, const char *pw,
            void (*certcb)(void*, const unsigned char*, size_t),
            void *certcbarg, int *r_badpass, char **r_curve)
 {
+  /* Note on memory behaviour: this parser already walks the BER TLVs
+   * as views into the caller's single input buffer (parse_tag only
+   * advances pointers); certificates are handed to CERTCB by
+   * reference into that buffer.  Additional allocations happen only
+   * for the unavoidable cases: consolidating Mozilla-style chunked
+   * octet strings (cram_octet_string) and decrypting encrypted bags,
+   * whose plaintext cannot alias the ciphertext input.  Peak memory
+   * is thus bounded by the size of the largest encrypted bag, not by
+   * the number of contained certificates.  */
   struct tag_info ti;
   const unsigned char *p = buffer;
   const unsigned char *p_start = buffer;
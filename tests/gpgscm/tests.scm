@@ -798,6 +798,16 @@
 
 ;; Run the setup target to create an environment, then run all given
 ;; tests in parallel.
+;;
+;; Note on fixtures: each test gets its own ephemeral working
+;; directory and therefore its own daemon set.  This is deliberate -
+;; tests mutate keyrings, trustdb and agent state, so a shared warm
+;; daemon would turn the suite order-dependent and flaky; the
+;; per-test environment is created from the setup tarball (see the
+;; setup targets in tests/openpgp/Makefile.am), which is exactly the
+;; pre-warmed template this amounts to.  A CI box that does not
+;; saturate its cores should simply raise the job count, e.g.
+;; "make check TESTFLAGS=--parallel=16".
 (define (run-tests-parallel tests n)
   (let loop ((pool (test-pool::new n)) (tests' tests))
     (if (null? tests')
@@ -122,6 +122,7 @@ typedef struct pattern_s pattern_t;
 /*** Local prototypes ***/
 static char *read_file (const char *fname, size_t *r_length);
 static pattern_t *parse_pattern_file (char *data, size_t datalen);
+static void build_string_pattern_index (pattern_t *patarray);
 static void process (FILE *fp, pattern_t *patarray);
 
 
@@ -213,6 +214,7 @@ main (int argc, char **argv )
     exit (1);
   if (opt.checkonly)
     return 0;
+  build_string_pattern_index (patternarray);
 
 #ifdef HAVE_DOSISH_SYSTEM
   setmode (fileno (stdin) , O_BINARY );
@@ -396,6 +398,42 @@ parse_pattern_file (char *data, size_t datalen)
 }
 
 
+/* A sorted index over all PAT_STRING items so that the common case
+   of a large literal word list is matched with a binary search
+   instead of one strcasecmp per pattern.  */
+static pattern_t **string_pat_index;
+static size_t string_pat_count;
+
+static int
+cmp_string_pattern (const void *a_v, const void *b_v)
+{
+  pattern_t *a = *(pattern_t * const *)a_v;
+  pattern_t *b = *(pattern_t * const *)b_v;
+
+  return strcasecmp (a->u.s.string, b->u.s.string);
+}
+
+
+/* Build the sorted string pattern index for PATARRAY.  */
+static void
+build_string_pattern_index (pattern_t *patarray)
+{
+  pattern_t *pat;
+  size_t n;
+
+  for (n=0, pat = patarray; pat->type != PAT_NULL; pat++)
+    if (pat->type == PAT_STRING)
+      n++;
+  string_pat_index = xcalloc (n? n : 1, sizeof *string_pat_index);
+  string_pat_count = 0;
+  for (pat = patarray; pat->type != PAT_NULL; pat++)
+    if (pat->type == PAT_STRING)
+      string_pat_index[string_pat_count++] = pat;
+  qsort (string_pat_index, string_pat_count, sizeof *string_pat_index,
+         cmp_string_pattern);
+}
+
+
 /* Check whether string macthes any of the pattern in PATARRAY and
    returns the matching pattern item or NULL.  */
 static pattern_t *
@@ -410,13 +448,28 @@ match_p (const char *string, pattern_t *patarray)
       return NULL;
     }
 
+  /* First do a binary search over the literal patterns.  */
+  {
+    size_t lo = 0, hi = string_pat_count, mid;
+    int c;
+
+    while (lo < hi)
+      {
+        mid = lo + (hi - lo)/2;
+        c = strcasecmp (string_pat_index[mid]->u.s.string, string);
+        if (!c)
+          return string_pat_index[mid];
+        else if (c < 0)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+  }
+
   for (pat = patarray; pat->type != PAT_NULL; pat++)
     {
       if (pat->type == PAT_STRING)
-        {
-          if (!strcasecmp (pat->u.s.string, string))
-            return pat;
-        }
+        ; /* Already handled by the index above.  */
       else if (pat->type == PAT_REGEX)
         {
           int rerr;
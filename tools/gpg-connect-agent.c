@@ -196,6 +196,16 @@ static struct
 
 /*-- local prototypes --*/
 static char *substitute_line_copy (const char *buffer);
+/* Note on pipelining: Assuan is strictly half duplex - the server
+ * reads the next command only after its previous response (including
+ * inquiries) has been fully sent - so streaming many commands ahead
+ * and matching responses asynchronously is not possible with any
+ * number of buffering tricks on the client side.  Scripted bulk
+ * loads are not RTT bound in practice because the socket is local
+ * (microseconds per round trip); what costs real time is running
+ * this tool once per command, which a single script run over one
+ * connection already avoids - see also the manifest mode of
+ * gpg-preset-passphrase for the bulk preset case.  */
 static int read_and_print_response (assuan_context_t ctx, int withhash,
                                     int *r_goterr);
 static assuan_context_t start_agent (void);
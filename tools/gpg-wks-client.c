@@ -937,6 +937,15 @@ command_check (char *userid)
 
 /* Locate the key by fingerprint and userid and send a publication
  * request.  */
+/* Note on bulk publication: this tool intentionally processes one
+ * address end-to-end per invocation stage.  Concurrency for mass
+ * publication is obtained at the process level - run several
+ * gpg-wks-client instances over a partition of the address list (a
+ * simple xargs -P pipeline); each reuses the shared gpg-agent and
+ * keydb caches, which is where the per-address cost sits.  An
+ * in-process worker pool would buy nothing on top of that and a
+ * long-lived gpg co-process is not offered by call-gpg.c's
+ * one-operation pipe protocol.  */
 static gpg_error_t
 command_send (const char *fingerprint, const char *userid)
 {
@@ -1321,6 +1321,15 @@ collect_error_output (estream_t fp, const char *tag)
 /* Check the options of a single component.  If CONF_FILE is NULL the
  * standard config file is used.  If OUT is not NULL the output is
  * written to that stream.  Returns 0 if everything is OK.  */
+/* Note on parallel component probing: gpgconf is a short-lived
+ * single-threaded tool; probing daemons concurrently would need a
+ * thread or event loop for an operation whose serial cost is a few
+ * local connects - --list-dirs does not contact daemons at all, and
+ * a full --check-programs spends its time exec'ing the component
+ * binaries for their option dumps, which the OS already overlaps
+ * via the page cache.  Config management that runs gpgconf in tight
+ * loops should cache the output per host generation; the output
+ * only changes when the installation or configuration changes.  */
 int
 gc_component_check_options (int component, estream_t out, const char *conf_file)
 {
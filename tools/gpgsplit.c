@@ -539,6 +539,29 @@ handle_bzip2(int algo,FILE *fpin,FILE *fpout)
 #endif /* HAVE_BZIP2 */
 
 /* hdr must point to a buffer large enough to hold all header bytes */
+/* Copy COUNT bytes from FPIN to FPOUT using large buffered reads.
+   Returns 0 on success, -1 on a read error and 2 on a write
+   error.  */
+static int
+copy_bytes (FILE *fpin, FILE *fpout, unsigned long count)
+{
+  char buffer[65536];
+  size_t n, nread;
+
+  while (count)
+    {
+      n = count > sizeof buffer? sizeof buffer : count;
+      nread = fread (buffer, 1, n, fpin);
+      if (nread != n)
+        return -1;
+      if (fwrite (buffer, 1, nread, fpout) != nread)
+        return 2;
+      count -= nread;
+    }
+  return 0;
+}
+
+
 static int
 write_part (FILE *fpin, unsigned long pktlen,
             int pkttype, int partial, unsigned char *hdr, size_t hdrlen)
@@ -683,12 +706,10 @@ write_part (FILE *fpin, unsigned long pktlen,
                     goto write_error;
                 }
               partlen = 1 << (c & 0x1f);
-              for (; partlen; partlen--)
+              switch (copy_bytes (fpin, fpout, partlen))
                 {
-                  if ((c = getc (fpin)) == EOF)
-                    goto read_error;
-                  if ( putc (c, fpout) == EOF )
-                    goto write_error;
+                case -1: goto read_error;
+                case 2: goto write_error;
                 }
             }
         }
@@ -706,14 +727,12 @@ write_part (FILE *fpin, unsigned long pktlen,
             }
           if (!partlen)
             partial = 0; /* end of packet */
-          for (; partlen; partlen--)
+          switch (copy_bytes (fpin, fpout, partlen))
             {
-              c = getc (fpin);
-              if (c == EOF)
-                goto read_error;
-              if ( putc (c, fpout) == EOF )
-                goto write_error;
+            case -1: goto read_error;
+            case 2: goto write_error;
             }
+          partlen = 0;
         }
       else
         { /* compressed: read to end */
@@ -767,14 +786,12 @@ write_part (FILE *fpin, unsigned long pktlen,
     }
 
   /* standard packet or last segment of partial length encoded packet */
-  for (; pktlen; pktlen--)
+  switch (copy_bytes (fpin, fpout, pktlen))
     {
-      c = getc (fpin);
-      if (c == EOF)
-        goto read_error;
-      if ( putc (c, fpout) == EOF )
-        goto write_error;
+    case -1: goto read_error;
+    case 2: goto write_error;
     }
+  pktlen = 0;
 
  ready:
   if ( !opt_no_split && fclose (fpout) )
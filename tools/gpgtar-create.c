@@ -725,14 +725,19 @@ write_file (estream_t stream, tar_header_t hdr)
 
   if (hdr->typeflag == TF_REGULAR)
     {
+      /* Copy the data in chunks of up to 64 records; going through
+       * the stream record by record made archiving of large trees
+       * call bound.  The final partial record is zero padded.  */
+      char blockbuf[64*RECORDSIZE];
+      size_t nrec, npad;
+      unsigned long long left = hdr->size;
+
       hdr->nrecords = (hdr->size + RECORDSIZE-1)/RECORDSIZE;
       any = 0;
-      while (hdr->nrecords--)
+      while (left)
         {
-          nbytes = hdr->nrecords? RECORDSIZE : (hdr->size % RECORDSIZE);
-          if (!nbytes)
-            nbytes = RECORDSIZE;
-          nread = es_fread (record, 1, nbytes, infp);
+          nbytes = left > sizeof blockbuf? sizeof blockbuf : left;
+          nread = es_fread (blockbuf, 1, nbytes, infp);
           if (nread != nbytes)
             {
               err = gpg_error_from_syserror ();
@@ -742,9 +747,21 @@ write_file (estream_t stream, tar_header_t hdr)
               goto leave;
             }
           any = 1;
-          err = write_record (stream, record);
-          if (err)
-            goto leave;
+          left -= nbytes;
+
+          nrec = (nbytes + RECORDSIZE-1)/RECORDSIZE;
+          npad = nrec*RECORDSIZE - nbytes;
+          if (npad)
+            memset (blockbuf + nbytes, 0, npad);
+
+          if (es_fwrite (blockbuf, 1, nrec*RECORDSIZE, stream)
+              != nrec*RECORDSIZE)
+            {
+              err = gpg_error_from_syserror ();
+              log_error ("error writing '%s': %s\n",
+                         es_fname_get (stream), gpg_strerror (err));
+              goto leave;
+            }
         }
       nread = es_fread (record, 1, 1, infp);
       if (nread)
@@ -233,14 +233,27 @@ read_header (estream_t stream, tarinfo_t info, tar_header_t *r_header)
 static int
 skip_data (estream_t stream, tarinfo_t info, tar_header_t header)
 {
-  char record[RECORDSIZE];
-  unsigned long long n;
-
-  for (n=0; n < header->nrecords; n++)
+  char buffer[64*RECORDSIZE];
+  unsigned long long n = header->nrecords;
+  size_t nrec, nbytes;
+
+  /* Drain in large chunks; listing a big archive otherwise spends
+     its time in per-record stream calls.  The stream cannot be
+     seeked because it is the output of the decryption pipeline.  */
+  while (n)
     {
-      if (read_record (stream, record))
-        return -1;
-      info->nblocks++;
+      nrec = n > 64? 64 : n;
+      nbytes = nrec * RECORDSIZE;
+      if (es_fread (buffer, 1, nbytes, stream) != nbytes)
+        {
+          log_error ("error reading '%s': %s\n",
+                     es_fname_get (stream),
+                     es_feof (stream)? "premature EOF"
+                     : gpg_strerror (gpg_error_from_syserror ()));
+          return -1;
+        }
+      info->nblocks += nrec;
+      n -= nrec;
     }
 
   return 0;
@@ -487,6 +487,14 @@ transition_to_header (rfc822parse_t msg)
 static int
 insert_header (rfc822parse_t msg, const unsigned char *line, size_t length)
 {
+  /* Note for optimizers: this allocation happens per *header* line
+     only; body lines are handed to the callbacks as views into the
+     caller's buffer without copying.  A typical mail has a few dozen
+     header lines, so replacing this with a view-based scanner would
+     save microseconds per message while losing the property that
+     header data stays valid for the whole lifetime of the part -
+     which the query functions (rfc822parse_get_field etc.) rely
+     on.  */
   HDR_LINE hdr;
 
   if (!msg->current_part)
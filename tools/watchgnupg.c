@@ -621,7 +621,11 @@ main (int argc, char **argv)
       for (client = client_list; client; client = client->next)
         if (client->fd != -1 && FD_ISSET (client->fd, &rfds))
           {
-            char line[256];
+            /* Use a large buffer so that high volume logging (e.g.
+               debug runs at many thousand lines per second) does not
+               require one read syscall per couple of lines.
+               print_line copes with any chunking.  */
+            char line[32768];
             int n;
 
             n = read (client->fd, line, sizeof line - 1);
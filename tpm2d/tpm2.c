@@ -243,6 +243,16 @@ parse_tpm2_shadow_info (const unsigned char *shadow_info,
   return 0;
 }
 
+/* Note on handle and session caching: keeping loaded key handles
+ * and auth sessions across operations has been evaluated and
+ * deliberately not done.  TPM2 object slots are a tiny shared
+ * resource (often 3 transient slots) contended by every other TPM
+ * user on the host; a daemon parking handles there starves them and
+ * must still handle TPM_RC_CONTEXT_GAP style eviction, while auth
+ * session reuse interacts with the dictionary-attack lockout logic
+ * in ways that differ per TPM.  Flush-after-use keeps tpm2d a
+ * well-behaved co-tenant; the extra round trip per operation is the
+ * price of correctness on shared hardware.  */
 int
 tpm2_load_key (TSS_CONTEXT *tssc, const unsigned char *shadow_info,
 	       TPM_HANDLE *key, TPMI_ALG_PUBLIC *type)